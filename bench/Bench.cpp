@@ -0,0 +1,163 @@
+// Micro-benchmarks of the per-frame paths against the code they replaced,
+// in CPU cycles per call (ESP.getCycleCount()). On the host the count is
+// derived from the clock at a notional 240 MHz, so compare the ratios
+// there, not the absolute numbers.
+//
+//   pio run -e bench && HAL_LOOPS=0 .pio/build/bench/program
+//   pio run -e bench-esp32 -t upload -t monitor
+//
+// Only the modules under test are built (see build_src_filter), not the
+// firmware: setup() runs each benchmark once and prints the results.
+#include "modules/Calibration.h"
+#include "modules/Config.h"
+#include "modules/TimeManager.h"
+#include <Arduino.h>
+#include <sys/time.h>
+
+#define BENCH_ITERATIONS 20000
+#define BENCH_TZ "CST6CDT,M3.2.0,M11.1.0"
+#define BENCH_EPOCH 1751373296 // 2025-07-01 12:34:56 UTC, DST in effect
+
+#define BENCH_CAL_MIN 12 // Three-point calibration, as the old path took it
+#define BENCH_CAL_MID 497
+#define BENCH_CAL_MAX 1013
+#define BENCH_SWEEP 600 // Inputs across 0-60 s, 0.1 s apart
+
+static Config config;
+static TimeManager timeManager(config);
+static volatile float sink; // Keeps the results from being optimised away
+
+// Cycles per call of f(), after one warm-up call
+template <typename F> static float bench(const char *name, F f) {
+  f();
+  uint32_t t0 = ESP.getCycleCount();
+  for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    f();
+  float cycles = (float)(ESP.getCycleCount() - t0) / BENCH_ITERATIONS;
+  Serial.printf("  %-34s %7.1f cycles %9.3f us\n", name, cycles,
+                cycles / ESP.getCpuFreqMHz());
+  return cycles;
+}
+
+static void compare(float before, float after) {
+  Serial.printf("  %-34s %7.1fx\n", "speedup", after ? (float)before / after : 0);
+}
+
+// --- Time reading per frame (TimeSnapshot) ---
+
+// Before: every getter did its own getLocalTime(), one TZ conversion each
+static int oldHour() {
+  struct tm t;
+  if (!getLocalTime(&t, 0))
+    return 0;
+  if (config.get12H()) {
+    int h = t.tm_hour % 12;
+    return h == 0 ? 12 : h;
+  }
+  return t.tm_hour;
+}
+
+static int oldField(int tm::*field) {
+  struct tm t;
+  return getLocalTime(&t, 0) ? t.*field : 0;
+}
+
+static float oldExactSecond() {
+  struct timeval tv;
+  struct tm t;
+  gettimeofday(&tv, NULL);
+  localtime_r(&tv.tv_sec, &t);
+  return t.tm_sec + tv.tv_usec / 1000000.0f;
+}
+
+static bool oldTimeSet() {
+  struct tm t;
+  return getLocalTime(&t, 0) && t.tm_year > (2020 - 1900);
+}
+
+static void benchTime() {
+  Serial.println("Time reading, one frame (hour, minute, second, valid, "
+                 "hour24):");
+  float before = bench("getLocalTime() per getter", [] {
+    float h = oldHour();
+    float m = oldField(&tm::tm_min);
+    float s = oldExactSecond();
+    bool valid = oldTimeSet();
+    int h24 = oldField(&tm::tm_hour);
+    sink = h + m + s + valid + h24;
+  });
+  float after = bench("capture() + snapshot getters", [] {
+    const TimeSnapshot &t = timeManager.capture();
+    float h = timeManager.getHour(t);
+    float m = t.local.tm_min;
+    float s = t.second;
+    bool valid = timeManager.isTimeSet();
+    int h24 = timeManager.getHour24();
+    sink = h + m + s + valid + h24;
+  });
+  compare(before, after);
+}
+
+// --- Needle mapping per meter (CalibrationTable) ---
+
+// Before: the float mapping each frame ran for each meter
+static float mapPiecewise(float x, float in_min, float in_mid, float in_max,
+                          float out_min, float out_mid, float out_max) {
+  if (x <= in_mid) {
+    return (x - in_min) * (out_mid - out_min) / (in_mid - in_min) + out_min;
+  } else {
+    return (x - in_mid) * (out_max - out_mid) / (in_max - in_mid) + out_mid;
+  }
+}
+
+static CalibrationTable table;
+static float sweep[BENCH_SWEEP];
+static int32_t sweepQ16[BENCH_SWEEP];
+static uint32_t next; // Walks the sweep so inputs vary per call
+// Read per call, as the old path read Config, so nothing folds away
+static volatile uint16_t calPoints[3] = {BENCH_CAL_MIN, BENCH_CAL_MID,
+                                         BENCH_CAL_MAX};
+
+static void benchCalibration() {
+  const uint16_t points[3] = {BENCH_CAL_MIN, BENCH_CAL_MID, BENCH_CAL_MAX};
+  table.build(points, 3, 60);
+  float worst = 0;
+  for (uint32_t i = 0; i < BENCH_SWEEP; i++) {
+    sweep[i] = i * (60.0f / BENCH_SWEEP);
+    sweepQ16[i] = (int32_t)(sweep[i] * 65536.0f);
+    float old = mapPiecewise(sweep[i], 0, 30, 60, BENCH_CAL_MIN,
+                             BENCH_CAL_MID, BENCH_CAL_MAX);
+    worst = max(worst, fabsf(table.map(sweep[i]) - old));
+  }
+
+  Serial.println("Needle mapping, one meter:");
+  float before = bench("float mapPiecewise()", [] {
+    float x = sweep[next++ % BENCH_SWEEP];
+    sink = mapPiecewise(x, 0, 30, 60, calPoints[0], calPoints[1],
+                        calPoints[2]);
+  });
+  float after = bench("CalibrationTable::mapQ16()", [] {
+    sink = table.mapQ16(sweepQ16[next++ % BENCH_SWEEP]);
+  });
+  bench("CalibrationTable::map(float)", [] {
+    sink = table.map(sweep[next++ % BENCH_SWEEP]);
+  });
+  compare(before, after);
+  Serial.printf("  %-34s %7.4f PWM\n", "worst difference", worst);
+}
+
+void setup() {
+  Serial.begin(115200);
+  config.begin();
+  setenv("TZ", BENCH_TZ, 1);
+  tzset();
+  struct timeval tv = {BENCH_EPOCH, 250000};
+  settimeofday(&tv, NULL);
+
+  Serial.printf("Benchmarks, %u iterations, %u MHz\n", BENCH_ITERATIONS,
+                (unsigned)ESP.getCpuFreqMHz());
+  benchTime();
+  benchCalibration();
+}
+
+void loop() { delay(1000); }
@@ -0,0 +1,277 @@
+#pragma once
+// Host-side stand-in for the ESP32 Arduino core.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <time.h>
+#include <sys/time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+// ArduinoJson only looks for String when ARDUINO is defined
+#define ARDUINOJSON_ENABLE_ARDUINO_STRING 1
+
+#define PROGMEM
+#define PGM_P const char *
+#define F(s) (s)
+#define IRAM_ATTR
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// newlib has strlcpy; glibc only from 2.38
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+inline size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = 0;
+  }
+  return len;
+}
+#endif
+
+class String {
+public:
+  String() {}
+  String(const char *s) : _s(s ? s : "") {}
+  String(const std::string &s) : _s(s) {}
+  String(char c) : _s(1, c) {}
+  String(int v) : _s(std::to_string(v)) {}
+  String(unsigned int v) : _s(std::to_string(v)) {}
+  String(long v) : _s(std::to_string(v)) {}
+  String(unsigned long v) : _s(std::to_string(v)) {}
+  String(long long v) : _s(std::to_string(v)) {}
+  String(unsigned long long v) : _s(std::to_string(v)) {}
+  String(float v, unsigned char decimals = 2) { fmt(v, decimals); }
+  String(double v, unsigned char decimals = 2) { fmt(v, decimals); }
+  String(int v, unsigned char base) {
+    char buf[34];
+    if (base == 16)
+      snprintf(buf, sizeof(buf), "%x", v);
+    else
+      snprintf(buf, sizeof(buf), "%d", v);
+    _s = buf;
+  }
+
+  const char *c_str() const { return _s.c_str(); }
+  // unsigned int on the ESP32, where that is size_t (ArduinoJson checks)
+  size_t length() const { return _s.length(); }
+  bool isEmpty() const { return _s.empty(); }
+  bool reserve(unsigned int n) {
+    _s.reserve(n);
+    return true;
+  }
+  long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(_s.c_str(), nullptr); }
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t p = _s.find(c, from);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  int indexOf(const String &s, unsigned int from = 0) const {
+    size_t p = _s.find(s._s, from);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  String substring(unsigned int from) const {
+    return from >= _s.size() ? String() : String(_s.substr(from));
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from >= _s.size() || to <= from)
+      return String();
+    return String(_s.substr(from, to - from));
+  }
+  void replace(const String &a, const String &b) {
+    if (a._s.empty())
+      return;
+    size_t p = 0;
+    while ((p = _s.find(a._s, p)) != std::string::npos) {
+      _s.replace(p, a._s.size(), b._s);
+      p += b._s.size();
+    }
+  }
+  void trim() {
+    size_t b = _s.find_first_not_of(" \t\r\n");
+    size_t e = _s.find_last_not_of(" \t\r\n");
+    _s = (b == std::string::npos) ? "" : _s.substr(b, e - b + 1);
+  }
+  bool startsWith(const String &p) const { return _s.rfind(p._s, 0) == 0; }
+  bool endsWith(const String &p) const {
+    return _s.size() >= p._s.size() &&
+           _s.compare(_s.size() - p._s.size(), p._s.size(), p._s) == 0;
+  }
+  char charAt(unsigned int i) const { return i < _s.size() ? _s[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  bool equals(const String &o) const { return _s == o._s; }
+
+  String &operator+=(const String &o) {
+    _s += o._s;
+    return *this;
+  }
+  String &operator+=(const char *o) {
+    _s += o;
+    return *this;
+  }
+  String &operator+=(char c) {
+    _s += c;
+    return *this;
+  }
+  String &operator+=(int v) {
+    _s += std::to_string(v);
+    return *this;
+  }
+  String &operator+=(unsigned int v) {
+    _s += std::to_string(v);
+    return *this;
+  }
+  String &operator+=(long v) {
+    _s += std::to_string(v);
+    return *this;
+  }
+  String &operator+=(unsigned long v) {
+    _s += std::to_string(v);
+    return *this;
+  }
+  bool concat(const char *s, unsigned int n) {
+    _s.append(s, n);
+    return true;
+  }
+  bool concat(const String &s) {
+    _s += s._s;
+    return true;
+  }
+  bool concat(char c) {
+    _s += c;
+    return true;
+  }
+  bool operator==(const String &o) const { return _s == o._s; }
+  bool operator==(const char *o) const { return _s == o; }
+  bool operator!=(const String &o) const { return _s != o._s; }
+  bool operator!=(const char *o) const { return _s != o; }
+
+  friend String operator+(const String &a, const String &b) {
+    return String(a._s + b._s);
+  }
+  friend String operator+(const String &a, const char *b) {
+    return String(a._s + b);
+  }
+  friend String operator+(const char *a, const String &b) {
+    return String(a + b._s);
+  }
+  friend String operator+(const String &a, char b) { return String(a._s + b); }
+
+  // ArduinoJson's Writer<::String> uses these
+  const std::string &str() const { return _s; }
+
+private:
+  std::string _s;
+  void fmt(double v, unsigned int decimals) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    _s = buf;
+  }
+};
+
+class __FlashStringHelper;
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) { return write(&c, 1); }
+  virtual size_t write(const uint8_t *buf, size_t n);
+  size_t print(const String &s) { return printf("%s", s.c_str()); }
+  size_t print(const char *s) { return printf("%s", s); }
+  size_t print(char c) { return printf("%c", c); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned int v) { return printf("%u", v); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(double v, int d = 2) { return printf("%.*f", d, v); }
+  size_t println() { return printf("\n"); }
+  template <typename T> size_t println(const T &v) {
+    size_t n = print(v);
+    return n + println();
+  }
+  size_t println(double v, int d) { return print(v, d) + println(); }
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  operator bool() const { return true; }
+};
+extern HardwareSerial Serial;
+
+class IPAddress {
+public:
+  IPAddress() : _a{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _a{a, b, c, d} {}
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _a[0], _a[1], _a[2], _a[3]);
+    return String(buf);
+  }
+  operator String() const { return toString(); }
+
+private:
+  uint8_t _a[4];
+};
+inline size_t printIP(Print &p, const IPAddress &ip) {
+  return p.print(ip.toString());
+}
+
+class EspClass {
+public:
+  void restart();
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz() { return 240; }
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getFreeSketchSpace() { return 0x180000; }
+};
+extern EspClass ESP;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+double ledcSetup(uint8_t channel, double freq, uint8_t resolution_bits);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+uint32_t ledcRead(uint8_t channel);
+
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+void configTzTime(const char *tz, const char *server1,
+                  const char *server2 = nullptr,
+                  const char *server3 = nullptr);
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+using std::abs;
+using std::max;
+using std::min;
+template <typename T, typename L, typename H>
+inline T constrain(T x, L lo, H hi) {
+  return x < lo ? lo : (x > hi ? hi : x);
+}
+
+void setup();
+void loop();
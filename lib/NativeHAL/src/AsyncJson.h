@@ -0,0 +1,50 @@
+#pragma once
+// Host-side AsyncCallbackJsonWebHandler (ESPAsyncWebServer's AsyncJson.h).
+// The harness puts the request body in request->_tempObject.
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+#ifndef DYNAMIC_JSON_DOCUMENT_SIZE
+#define DYNAMIC_JSON_DOCUMENT_SIZE 1024
+#endif
+
+typedef std::function<void(AsyncWebServerRequest *request, JsonVariant &json)>
+    ArJsonRequestHandlerFunction;
+
+class AsyncCallbackJsonWebHandler : public AsyncWebHandler {
+public:
+  AsyncCallbackJsonWebHandler(const String &uri,
+                              ArJsonRequestHandlerFunction onRequest,
+                              size_t maxJsonBufferSize =
+                                  DYNAMIC_JSON_DOCUMENT_SIZE)
+      : _uri(uri), _onRequest(onRequest), _maxJsonBufferSize(maxJsonBufferSize) {}
+
+  void setMethod(WebRequestMethodComposite method) { _method = method; }
+  void setMaxContentLength(int length) { _maxContentLength = length; }
+  void onRequest(ArJsonRequestHandlerFunction fn) { _onRequest = fn; }
+
+  bool canHandle(AsyncWebServerRequest *request) override {
+    return request->url() == _uri && (request->method() & _method);
+  }
+
+  void handleRequest(AsyncWebServerRequest *request) override {
+    if ((int)request->_tempObject.length() > _maxContentLength) {
+      request->send(413);
+      return;
+    }
+    DynamicJsonDocument doc(_maxJsonBufferSize);
+    if (deserializeJson(doc, request->_tempObject.c_str())) {
+      request->send(400);
+      return;
+    }
+    JsonVariant json = doc.as<JsonVariant>();
+    _onRequest(request, json);
+  }
+
+private:
+  String _uri;
+  WebRequestMethodComposite _method = HTTP_POST | HTTP_PUT | HTTP_PATCH;
+  ArJsonRequestHandlerFunction _onRequest;
+  size_t _maxJsonBufferSize;
+  int _maxContentLength = 16384;
+};
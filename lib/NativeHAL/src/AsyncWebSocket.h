@@ -0,0 +1,164 @@
+#pragma once
+// Host-side AsyncWebSocket stand-in. A harness connects clients, feeds them
+// text messages and reads back what was sent; each client's send queue
+// holds WS_MAX_QUEUED_MESSAGES until drain() (the "network") empties it.
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+#ifndef WS_MAX_QUEUED_MESSAGES
+#define WS_MAX_QUEUED_MESSAGES 32
+#endif
+#ifndef DEFAULT_MAX_WS_CLIENTS
+#define DEFAULT_MAX_WS_CLIENTS 8
+#endif
+
+class AsyncWebSocket;
+class AsyncWebSocketClient;
+
+typedef enum {
+  WS_EVT_CONNECT,
+  WS_EVT_DISCONNECT,
+  WS_EVT_PONG,
+  WS_EVT_ERROR,
+  WS_EVT_DATA
+} AwsEventType;
+typedef enum {
+  WS_CONTINUATION,
+  WS_TEXT,
+  WS_BINARY,
+  WS_DISCONNECT = 0x08,
+  WS_PING,
+  WS_PONG
+} AwsFrameType;
+typedef enum { WS_DISCONNECTED, WS_CONNECTED, WS_DISCONNECTING } AwsClientStatus;
+
+typedef struct {
+  uint8_t message_opcode;
+  uint32_t num;
+  uint8_t final;
+  uint8_t masked;
+  uint8_t opcode;
+  uint64_t len;
+  uint8_t mask[4];
+  uint64_t index;
+} AwsFrameInfo;
+
+typedef std::function<void(AsyncWebSocket *server,
+                           AsyncWebSocketClient *client, AwsEventType type,
+                           void *arg, uint8_t *data, size_t len)>
+    AwsEventHandler;
+
+class AsyncWebSocketClient {
+public:
+  AsyncWebSocketClient(AsyncWebSocket *server, uint32_t id)
+      : _server(server), _id(id) {}
+  uint32_t id() const { return _id; }
+  AwsClientStatus status() const { return _status; }
+  IPAddress remoteIP() { return IPAddress(127, 0, 0, 1); }
+  AsyncWebSocket *server() { return _server; }
+
+  bool queueIsFull() const {
+    return _queued >= WS_MAX_QUEUED_MESSAGES || _status != WS_CONNECTED;
+  }
+  size_t queueLen() const { return _queued; }
+
+  void text(const char *message, size_t len) {
+    if (queueIsFull())
+      return; // The library drops it too
+    _queued++;
+    _sent.push_back(std::string(message, len));
+  }
+  void text(const char *message) { text(message, strlen(message)); }
+  void text(const String &message) { text(message.c_str(), message.length()); }
+  void close(uint16_t code = 0, const char *message = nullptr) {
+    _status = WS_DISCONNECTING;
+  }
+
+  // Harness side
+  void drain() { _queued = 0; }
+  std::vector<std::string> _sent;
+
+private:
+  AsyncWebSocket *_server;
+  uint32_t _id;
+  AwsClientStatus _status = WS_CONNECTED;
+  size_t _queued = 0;
+};
+
+class AsyncWebSocket : public AsyncWebHandler {
+public:
+  explicit AsyncWebSocket(const String &url) : _url(url) {}
+  ~AsyncWebSocket() {
+    for (auto *c : _clients)
+      delete c;
+  }
+  const char *url() const { return _url.c_str(); }
+  void onEvent(AwsEventHandler handler) { _handler = handler; }
+
+  AsyncWebSocketClient *client(uint32_t id) {
+    for (auto *c : _clients) {
+      if (c->id() == id && c->status() == WS_CONNECTED)
+        return c;
+    }
+    return nullptr;
+  }
+  size_t count() const {
+    size_t n = 0;
+    for (auto *c : _clients)
+      n += c->status() == WS_CONNECTED;
+    return n;
+  }
+  void cleanupClients(uint16_t maxClients = DEFAULT_MAX_WS_CLIENTS) {
+    for (auto it = _clients.begin(); it != _clients.end();) {
+      AsyncWebSocketClient *c = *it++;
+      if (c->status() != WS_CONNECTED)
+        disconnect(c); // Closed: the TCP side would have gone by now
+    }
+    while (count() > maxClients)
+      disconnect(_clients.front());
+  }
+  void textAll(const char *message, size_t len) {
+    for (auto *c : _clients)
+      c->text(message, len);
+  }
+  void textAll(const String &message) {
+    textAll(message.c_str(), message.length());
+  }
+
+  // Harness side: what the async_tcp task would do
+  AsyncWebSocketClient *connect() {
+    AsyncWebSocketClient *c = new AsyncWebSocketClient(this, ++_nextId);
+    _clients.push_back(c);
+    event(c, WS_EVT_CONNECT, nullptr, nullptr, 0);
+    if (c->status() != WS_CONNECTED) {
+      disconnect(c); // Turned away by the handler
+      return nullptr;
+    }
+    return c;
+  }
+  void receive(AsyncWebSocketClient *c, const String &message) {
+    AwsFrameInfo info = {WS_TEXT, 0, 1, 1, WS_TEXT, message.length(), {0},
+                         0};
+    event(c, WS_EVT_DATA, &info, (uint8_t *)message.c_str(),
+          message.length());
+  }
+  void disconnect(AsyncWebSocketClient *c) {
+    _clients.remove(c);
+    event(c, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+    delete c;
+  }
+
+private:
+  String _url;
+  AwsEventHandler _handler;
+  std::list<AsyncWebSocketClient *> _clients;
+  uint32_t _nextId = 0;
+
+  void event(AsyncWebSocketClient *c, AwsEventType type, void *arg,
+             uint8_t *data, size_t len) {
+    if (_handler)
+      _handler(this, c, type, arg, data, len);
+  }
+};
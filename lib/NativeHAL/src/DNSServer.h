@@ -0,0 +1,11 @@
+#pragma once
+#include <Arduino.h>
+
+enum class DNSReplyCode { NoError = 0 };
+
+class DNSServer {
+public:
+  void setErrorReplyCode(DNSReplyCode) {}
+  bool start(uint16_t, const String &, const IPAddress &) { return true; }
+  void processNextRequest() {}
+};
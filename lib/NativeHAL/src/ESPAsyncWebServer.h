@@ -0,0 +1,168 @@
+#pragma once
+// Host-side ESPAsyncWebServer stand-in. Routes are recorded so a host
+// harness can dispatch requests to the real handlers.
+#include <Arduino.h>
+#include <functional>
+#include <map>
+#include <vector>
+
+typedef enum {
+  HTTP_GET = 0b00000001,
+  HTTP_POST = 0b00000010,
+  HTTP_DELETE = 0b00000100,
+  HTTP_PUT = 0b00001000,
+  HTTP_PATCH = 0b00010000,
+  HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncClient {
+public:
+  IPAddress remoteIP() { return IPAddress(127, 0, 0, 1); }
+};
+
+class AsyncWebServerResponse {
+public:
+  AsyncWebServerResponse(int code, const String &type, const String &body)
+      : _code(code), _type(type), _body(body) {}
+  virtual ~AsyncWebServerResponse() {}
+  void addHeader(const String &name, const String &value) {
+    _headers[name.c_str()] = value;
+  }
+  int code() const { return _code; }
+  const String &body() const { return _body; }
+  const String &contentType() const { return _type; }
+  String header(const char *name) const {
+    auto it = _headers.find(name);
+    return it == _headers.end() ? String() : it->second;
+  }
+
+protected:
+  int _code;
+  String _type;
+  String _body;
+  std::map<std::string, String> _headers;
+};
+
+class AsyncWebServerRequest {
+public:
+  AsyncWebServerRequest(WebRequestMethod method, const String &url)
+      : _method(method), _url(url) {}
+  ~AsyncWebServerRequest() { delete _response; }
+  const String &url() const { return _url; }
+  WebRequestMethod method() const { return _method; }
+  AsyncClient *client() { return &_client; }
+  bool hasArg(const char *name) const { return _args.count(name) > 0; }
+  String arg(const char *name) const {
+    auto it = _args.find(name);
+    return it == _args.end() ? String() : it->second;
+  }
+  bool hasHeader(const char *name) const { return _reqHeaders.count(name) > 0; }
+  String header(const char *name) const {
+    auto it = _reqHeaders.find(name);
+    return it == _reqHeaders.end() ? String() : it->second;
+  }
+  void setArg(const char *name, const String &value) { _args[name] = value; }
+  void setHeader(const char *name, const String &value) {
+    _reqHeaders[name] = value;
+  }
+
+  AsyncWebServerResponse *beginResponse(int code,
+                                        const String &type = String(),
+                                        const String &body = String()) {
+    return new AsyncWebServerResponse(code, type, body);
+  }
+  AsyncWebServerResponse *beginResponse_P(int code, const String &type,
+                                          const uint8_t *data, size_t len) {
+    return new AsyncWebServerResponse(
+        code, type, String(std::string((const char *)data, len)));
+  }
+  void send(AsyncWebServerResponse *r) {
+    delete _response;
+    _response = r;
+  }
+  void send(int code, const String &type = String(),
+            const String &body = String()) {
+    send(beginResponse(code, type, body));
+  }
+  void redirect(const String &url) {
+    AsyncWebServerResponse *r = beginResponse(302, "text/plain");
+    r->addHeader("Location", url);
+    send(r);
+  }
+  AsyncWebServerResponse *response() const { return _response; }
+
+  // Body used by JSON handlers
+  String _tempObject;
+
+private:
+  WebRequestMethod _method;
+  String _url;
+  AsyncClient _client;
+  std::map<std::string, String> _args;
+  std::map<std::string, String> _reqHeaders;
+  AsyncWebServerResponse *_response = nullptr;
+};
+
+typedef std::function<void(AsyncWebServerRequest *)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *, const String &, size_t,
+                           uint8_t *, size_t, bool)>
+    ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *, uint8_t *, size_t, size_t,
+                           size_t)>
+    ArBodyHandlerFunction;
+
+class AsyncWebHandler {
+public:
+  virtual ~AsyncWebHandler() {}
+  virtual bool canHandle(AsyncWebServerRequest *) { return false; }
+  virtual void handleRequest(AsyncWebServerRequest *) {}
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+public:
+  String uri;
+  WebRequestMethodComposite method = HTTP_ANY;
+  ArRequestHandlerFunction onRequest;
+  ArUploadHandlerFunction onUpload;
+  ArBodyHandlerFunction onBody;
+};
+
+class AsyncWebServer {
+public:
+  AsyncWebServer(uint16_t port) : _port(port) {}
+  ~AsyncWebServer() {
+    for (auto *h : _handlers)
+      delete h;
+  }
+  void begin() {}
+  AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method,
+                              ArRequestHandlerFunction onRequest,
+                              ArUploadHandlerFunction onUpload = nullptr,
+                              ArBodyHandlerFunction onBody = nullptr) {
+    AsyncCallbackWebHandler *h = new AsyncCallbackWebHandler();
+    h->uri = uri;
+    h->method = method;
+    h->onRequest = onRequest;
+    h->onUpload = onUpload;
+    h->onBody = onBody;
+    _handlers.push_back(h);
+    return *h;
+  }
+  AsyncWebHandler &addHandler(AsyncWebHandler *h) {
+    _extra.push_back(h);
+    return *h;
+  }
+  void onNotFound(ArRequestHandlerFunction fn) { _notFound = fn; }
+
+  // Host harness entry point: runs the matching handler synchronously.
+  void dispatch(AsyncWebServerRequest *request);
+
+private:
+  uint16_t _port;
+  std::vector<AsyncCallbackWebHandler *> _handlers;
+  std::vector<AsyncWebHandler *> _extra;
+  ArRequestHandlerFunction _notFound;
+};
+
+#include "AsyncWebSocket.h"
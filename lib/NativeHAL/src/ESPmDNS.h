@@ -0,0 +1,9 @@
+#pragma once
+#include <Arduino.h>
+
+class MDNSResponder {
+public:
+  bool begin(const char *) { return true; }
+  void addService(const char *, const char *, uint16_t) {}
+};
+extern MDNSResponder MDNS;
@@ -0,0 +1,70 @@
+#pragma once
+// Host-side subset of FastLED: CRGB math plus a controller that records
+// every show() for inspection.
+#include <Arduino.h>
+
+enum EOrder { RGB = 0012, GRB = 0102 };
+enum LEDColorCorrection { TypicalLEDStrip = 0xFFB0F0, UncorrectedColor = 0xFFFFFF };
+
+struct CRGB {
+  uint8_t r, g, b;
+  enum HTMLColorCode : uint32_t {
+    Black = 0x000000,
+    White = 0xFFFFFF,
+    Red = 0xFF0000,
+    Green = 0x008000,
+    Blue = 0x0000FF,
+    Purple = 0x800080,
+  };
+  CRGB() : r(0), g(0), b(0) {}
+  CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  CRGB(uint32_t c) : r((c >> 16) & 0xFF), g((c >> 8) & 0xFF), b(c & 0xFF) {}
+  CRGB(HTMLColorCode c) : CRGB((uint32_t)c) {}
+  uint8_t &operator[](uint8_t i) { return i == 0 ? r : (i == 1 ? g : b); }
+  const uint8_t &operator[](uint8_t i) const {
+    return i == 0 ? r : (i == 1 ? g : b);
+  }
+  bool operator==(const CRGB &o) const {
+    return r == o.r && g == o.g && b == o.b;
+  }
+  bool operator!=(const CRGB &o) const { return !(*this == o); }
+};
+
+inline void fill_solid(CRGB *leds, int n, const CRGB &c) {
+  for (int i = 0; i < n; i++)
+    leds[i] = c;
+}
+
+template <uint8_t DATA_PIN, EOrder RGB_ORDER> class WS2811 {};
+
+class CLEDController {
+public:
+  CLEDController &setCorrection(uint32_t c) {
+    _correction = c;
+    return *this;
+  }
+  CRGB *leds = nullptr;
+  int count = 0;
+  uint32_t _correction = 0xFFFFFF;
+};
+
+class CFastLED {
+public:
+  template <template <uint8_t, EOrder> class CHIPSET, uint8_t DATA_PIN,
+            EOrder RGB_ORDER>
+  CLEDController &addLeds(CRGB *leds, int n) {
+    _ctrl.leds = leds;
+    _ctrl.count = n;
+    return _ctrl;
+  }
+  void setBrightness(uint8_t b) { _brightness = b; }
+  uint8_t getBrightness() { return _brightness; }
+  void show();
+  uint32_t showCount() const { return _shows; }
+
+private:
+  CLEDController _ctrl;
+  uint8_t _brightness = 255;
+  uint32_t _shows = 0;
+};
+extern CFastLED FastLED;
@@ -0,0 +1,345 @@
+#include "NativeHAL.h"
+#include <Preferences.h>
+#include <RTClib.h>
+#include <Wire.h>
+#include <WiFi.h>
+#include <ESPmDNS.h>
+#include <Update.h>
+#include <FastLED.h>
+#include <ESPAsyncWebServer.h>
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <driver/ledc.h>
+#include <driver/rmt.h>
+#include <vector>
+#include <chrono>
+#include <cstdarg>
+#include <map>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+TwoWire Wire;
+WiFiClass WiFi;
+MDNSResponder MDNS;
+UpdateClass Update;
+CFastLED FastLED;
+
+namespace {
+bool s_realtime = true;
+uint64_t s_virtualUs = 0;
+int64_t s_wallOffsetUs = // wall clock = monotonic + offset, host time at start
+    std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+        .count();
+uint32_t s_duty[16];
+uint8_t s_pins[64];
+hal::LedcTap s_ledcTap;
+hal::LedTap s_ledTap;
+bool s_sntp = false;
+bool s_serialOutput = true;
+std::map<std::string, std::map<std::string, std::vector<uint8_t>>> s_nvs;
+
+uint64_t hostMicros() {
+  using namespace std::chrono;
+  static const auto start = steady_clock::now();
+  return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+} // namespace
+
+struct esp_timer {
+  esp_timer_cb_t cb;
+  void *arg;
+  uint64_t period;
+  uint64_t next;
+  bool active;
+};
+static std::vector<esp_timer *> s_timers;
+
+// Run every timer due up to `end`, in deadline order
+static void fireTimers(uint64_t end) {
+  for (;;) {
+    esp_timer *due = nullptr;
+    for (esp_timer *t : s_timers) {
+      if (t->active && t->next <= end && (!due || t->next < due->next))
+        due = t;
+    }
+    if (!due)
+      return;
+    if (due->next > s_virtualUs)
+      s_virtualUs = due->next;
+    if (due->period)
+      due->next += due->period;
+    else
+      due->active = false;
+    due->cb(due->arg);
+  }
+}
+
+namespace hal {
+void setRealtime(bool enabled) {
+  s_virtualUs = nowMicros();
+  s_realtime = enabled;
+}
+uint64_t nowMicros() { return s_realtime ? hostMicros() : s_virtualUs; }
+void advance(uint64_t us) {
+  if (s_realtime) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+    fireTimers(hostMicros());
+    return;
+  }
+  uint64_t end = s_virtualUs + us;
+  fireTimers(end);
+  s_virtualUs = end;
+}
+void setWallClock(time_t utc, uint32_t usec) {
+  s_wallOffsetUs = (int64_t)utc * 1000000LL + usec - (int64_t)nowMicros();
+}
+void setPin(uint8_t pin, int level) { s_pins[pin & 63] = level; }
+void onLedcWrite(LedcTap tap) { s_ledcTap = tap; }
+uint32_t ledcDuty(uint8_t channel) { return s_duty[channel & 15]; }
+void onLedShow(LedTap tap) { s_ledTap = tap; }
+void setSerialOutput(bool enabled) { s_serialOutput = enabled; }
+} // namespace hal
+
+// Wall clock interposition so TimeManager's gettimeofday()/time() follow
+// the virtual clock.
+extern "C" int gettimeofday(struct timeval *tv, void *) {
+  int64_t us = (int64_t)hal::nowMicros() + s_wallOffsetUs;
+  tv->tv_sec = us / 1000000LL;
+  tv->tv_usec = us % 1000000LL;
+  return 0;
+}
+extern "C" int settimeofday(const struct timeval *tv, const struct timezone *) {
+  hal::setWallClock(tv->tv_sec, tv->tv_usec);
+  return 0;
+}
+extern "C" time_t time(time_t *out) {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  if (out)
+    *out = tv.tv_sec;
+  return tv.tv_sec;
+}
+
+// Serial goes to stdout unless a simulator muted it
+size_t Print::write(const uint8_t *buf, size_t n) {
+  return s_serialOutput ? fwrite(buf, 1, n, stdout) : n;
+}
+size_t Print::printf(const char *fmt, ...) {
+  if (!s_serialOutput)
+    return 0;
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vprintf(fmt, ap);
+  va_end(ap);
+  return n < 0 ? 0 : n;
+}
+
+void EspClass::restart() {
+  Serial.println("[HAL] ESP.restart() requested");
+}
+uint32_t EspClass::getCycleCount() {
+  return (uint32_t)(hal::nowMicros() * getCpuFreqMHz());
+}
+
+unsigned long millis() { return (unsigned long)(hal::nowMicros() / 1000); }
+unsigned long micros() { return (unsigned long)hal::nowMicros(); }
+void delay(uint32_t ms) { hal::advance((uint64_t)ms * 1000); }
+void delayMicroseconds(uint32_t us) { hal::advance(us); }
+void yield() {}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (mode == INPUT_PULLUP)
+    s_pins[pin & 63] = HIGH;
+}
+void digitalWrite(uint8_t pin, uint8_t val) { s_pins[pin & 63] = val; }
+int digitalRead(uint8_t pin) { return s_pins[pin & 63]; }
+
+double ledcSetup(uint8_t, double freq, uint8_t) { return freq; }
+void ledcAttachPin(uint8_t, uint8_t) {}
+void ledcWrite(uint8_t channel, uint32_t duty) {
+  s_duty[channel & 15] = duty;
+  if (s_ledcTap)
+    s_ledcTap(channel, duty);
+}
+uint32_t ledcRead(uint8_t channel) { return s_duty[channel & 15]; }
+
+bool getLocalTime(struct tm *info, uint32_t) {
+  time_t now = time(nullptr);
+  localtime_r(&now, info);
+  return info->tm_year > (2016 - 1900);
+}
+void configTzTime(const char *tz, const char *, const char *, const char *) {
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+bool sntp_enabled() { return s_sntp; }
+void sntp_stop() { s_sntp = false; }
+void sntp_init() { s_sntp = true; }
+void sntp_setoperatingmode(int) {}
+void sntp_setservername(int, const char *) {}
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t) {}
+
+wl_status_t WiFiClass::status() { return _status; }
+
+bool RTC_DS3231::begin(TwoWire *) { return true; }
+DateTime RTC_DS3231::now() { return DateTime((uint32_t)time(nullptr)); }
+void RTC_DS3231::adjust(const DateTime &) {}
+
+void CFastLED::show() {
+  _shows++;
+  if (s_ledTap)
+    s_ledTap((const uint8_t *)_ctrl.leds, _ctrl.count, _brightness);
+}
+
+bool Preferences::begin(const char *name, bool) {
+  _ns = name;
+  return true;
+}
+bool Preferences::clear() {
+  s_nvs[_ns].clear();
+  return true;
+}
+bool Preferences::remove(const char *key) {
+  return s_nvs[_ns].erase(key) > 0;
+}
+bool Preferences::isKey(const char *key) { return s_nvs[_ns].count(key) > 0; }
+size_t Preferences::putRaw(const char *key, const void *v, size_t len) {
+  const uint8_t *p = (const uint8_t *)v;
+  s_nvs[_ns][key] = std::vector<uint8_t>(p, p + len);
+  return len;
+}
+const std::vector<uint8_t> *Preferences::find(const char *key) {
+  auto &ns = s_nvs[_ns];
+  auto it = ns.find(key);
+  return it == ns.end() ? nullptr : &it->second;
+}
+String Preferences::getString(const char *key, const String &d) {
+  const std::vector<uint8_t> *v = find(key);
+  if (!v)
+    return d;
+  return String(std::string(v->begin(), v->end()));
+}
+size_t Preferences::getBytesLength(const char *key) {
+  const std::vector<uint8_t> *v = find(key);
+  return v ? v->size() : 0;
+}
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+  const std::vector<uint8_t> *v = find(key);
+  if (!v || v->size() > maxLen)
+    return 0;
+  memcpy(buf, v->data(), v->size());
+  return v->size();
+}
+
+void AsyncWebServer::dispatch(AsyncWebServerRequest *request) {
+  for (auto *h : _handlers) {
+    if (h->uri == request->url() && (h->method & request->method())) {
+      h->onRequest(request);
+      return;
+    }
+  }
+  for (auto *h : _extra) {
+    if (h->canHandle(request)) {
+      h->handleRequest(request);
+      return;
+    }
+  }
+  if (_notFound)
+    _notFound(request);
+}
+
+esp_err_t ledc_fade_func_install(int) { return ESP_OK; }
+esp_err_t ledc_set_fade_time_and_start(ledc_mode_t mode, ledc_channel_t channel,
+                                       uint32_t duty, uint32_t,
+                                       ledc_fade_mode_t) {
+  ledcWrite(mode * 8 + channel, duty);
+  return ESP_OK;
+}
+uint32_t ledc_get_duty(ledc_mode_t mode, ledc_channel_t channel) {
+  return ledcRead(mode * 8 + channel);
+}
+
+static sample_to_rmt_t s_rmtTranslator[RMT_CHANNEL_MAX];
+
+esp_err_t rmt_config(const rmt_config_t *) { return ESP_OK; }
+esp_err_t rmt_driver_install(rmt_channel_t, size_t, int) { return ESP_OK; }
+esp_err_t rmt_translator_init(rmt_channel_t channel, sample_to_rmt_t fn) {
+  s_rmtTranslator[channel] = fn;
+  return ESP_OK;
+}
+esp_err_t rmt_write_sample(rmt_channel_t channel, const uint8_t *src,
+                           size_t size, bool) {
+  sample_to_rmt_t fn = s_rmtTranslator[channel];
+  if (!fn)
+    return ESP_ERR_INVALID_STATE;
+
+  // Translate in RMT memory sized chunks, then read the bits back: a 1
+  // stays high for more than a third of the bit
+  std::vector<uint8_t> bytes;
+  rmt_item32_t items[64];
+  size_t done = 0;
+  while (done < size) {
+    size_t used = 0, count = 0;
+    fn(src + done, items, size - done, 64, &used, &count);
+    if (used == 0)
+      return ESP_FAIL;
+    for (size_t i = 0; i + 8 <= count; i += 8) {
+      uint8_t b = 0;
+      for (size_t bit = 0; bit < 8; bit++) {
+        const rmt_item32_t &it = items[i + bit];
+        b = (b << 1) | (3 * it.duration0 > it.duration0 + it.duration1);
+      }
+      bytes.push_back(b);
+    }
+    done += used;
+  }
+  if (s_ledTap)
+    s_ledTap(bytes.data(), (int)(bytes.size() / 3), 255);
+  return ESP_OK;
+}
+esp_err_t rmt_wait_tx_done(rmt_channel_t, TickType_t) { return ESP_OK; }
+
+int64_t esp_timer_get_time() { return (int64_t)hal::nowMicros(); }
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args,
+                           esp_timer_handle_t *out) {
+  esp_timer *t = new esp_timer{args->callback, args->arg, 0, 0, false};
+  s_timers.push_back(t);
+  *out = t;
+  return ESP_OK;
+}
+esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t timeout) {
+  if (t->active)
+    return ESP_ERR_INVALID_STATE;
+  t->period = 0;
+  t->next = hal::nowMicros() + timeout;
+  t->active = true;
+  return ESP_OK;
+}
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t t, uint64_t period) {
+  t->period = period;
+  t->next = hal::nowMicros() + period;
+  t->active = true;
+  return ESP_OK;
+}
+bool esp_timer_is_active(esp_timer_handle_t t) { return t->active; }
+esp_err_t esp_timer_stop(esp_timer_handle_t t) {
+  if (!t->active)
+    return ESP_ERR_INVALID_STATE;
+  t->active = false;
+  return ESP_OK;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char *name, uint32_t,
+                                   void *, UBaseType_t, TaskHandle_t *handle,
+                                   BaseType_t) {
+  if (handle)
+    *handle = (TaskHandle_t)name;
+  return pdPASS;
+}
+void vTaskDelay(TickType_t ticks) { hal::advance((uint64_t)ticks * 1000); }
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 1; }
+BaseType_t xTaskNotifyGive(TaskHandle_t) { return pdPASS; }
+TaskHandle_t xTaskGetCurrentTaskHandle() { return (TaskHandle_t) "loopTask"; }
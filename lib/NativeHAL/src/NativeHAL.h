@@ -0,0 +1,33 @@
+#pragma once
+// Control surface of the host HAL: virtual clock, pin injection and
+// output taps used by host benchmarks and simulators.
+#include <Arduino.h>
+#include <functional>
+
+namespace hal {
+
+// Virtual time. The clock only moves when advance() is called, unless
+// realtime mode is enabled (the default for interactive runs). Either way
+// advance() is where esp_timer callbacks run: in realtime it sleeps, then
+// runs the ones that fell due on the host clock.
+void setRealtime(bool enabled);
+uint64_t nowMicros();
+void advance(uint64_t us);
+void setWallClock(time_t utc, uint32_t usec = 0);
+
+void setPin(uint8_t pin, int level);
+
+typedef std::function<void(uint8_t channel, uint32_t duty)> LedcTap;
+void onLedcWrite(LedcTap tap);
+uint32_t ledcDuty(uint8_t channel);
+
+// FastLED.show() reports raw pixels and its brightness; RMT writes report
+// the bytes as sent (wire order, already scaled) with brightness 255
+typedef std::function<void(const uint8_t *rgb, int count, uint8_t brightness)>
+    LedTap;
+void onLedShow(LedTap tap);
+
+// Firmware Serial output (on by default)
+void setSerialOutput(bool enabled);
+
+} // namespace hal
@@ -0,0 +1,54 @@
+#pragma once
+// Host-side Preferences backed by an in-memory key/value map.
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false);
+  void end() {}
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+
+  size_t putBool(const char *key, bool v) { return putRaw(key, &v, sizeof(v)); }
+  size_t putUChar(const char *key, uint8_t v) { return putRaw(key, &v, sizeof(v)); }
+  size_t putUShort(const char *key, uint16_t v) { return putRaw(key, &v, sizeof(v)); }
+  size_t putShort(const char *key, int16_t v) { return putRaw(key, &v, sizeof(v)); }
+  size_t putUInt(const char *key, uint32_t v) { return putRaw(key, &v, sizeof(v)); }
+  size_t putInt(const char *key, int32_t v) { return putRaw(key, &v, sizeof(v)); }
+  size_t putULong64(const char *key, uint64_t v) { return putRaw(key, &v, sizeof(v)); }
+  size_t putFloat(const char *key, float v) { return putRaw(key, &v, sizeof(v)); }
+  size_t putString(const char *key, const String &v) {
+    return putRaw(key, v.c_str(), v.length());
+  }
+  size_t putBytes(const char *key, const void *v, size_t len) {
+    return putRaw(key, v, len);
+  }
+
+  bool getBool(const char *key, bool d = false) { return get(key, d); }
+  uint8_t getUChar(const char *key, uint8_t d = 0) { return get(key, d); }
+  uint16_t getUShort(const char *key, uint16_t d = 0) { return get(key, d); }
+  int16_t getShort(const char *key, int16_t d = 0) { return get(key, d); }
+  uint32_t getUInt(const char *key, uint32_t d = 0) { return get(key, d); }
+  int32_t getInt(const char *key, int32_t d = 0) { return get(key, d); }
+  uint64_t getULong64(const char *key, uint64_t d = 0) { return get(key, d); }
+  float getFloat(const char *key, float d = 0) { return get(key, d); }
+  String getString(const char *key, const String &d = String());
+  size_t getBytesLength(const char *key);
+  size_t getBytes(const char *key, void *buf, size_t maxLen);
+
+private:
+  std::string _ns;
+  size_t putRaw(const char *key, const void *v, size_t len);
+  const std::vector<uint8_t> *find(const char *key);
+  template <typename T> T get(const char *key, T d) {
+    const std::vector<uint8_t> *v = find(key);
+    if (!v || v->size() != sizeof(T))
+      return d;
+    T out;
+    memcpy(&out, v->data(), sizeof(T));
+    return out;
+  }
+};
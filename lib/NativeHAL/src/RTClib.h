@@ -0,0 +1,27 @@
+#pragma once
+// Host-side DS3231 stand-in: always reads the (virtual) system clock.
+#include <Arduino.h>
+#include <Wire.h>
+
+class DateTime {
+public:
+  DateTime(uint32_t t = 0) : _t(t) {}
+  uint32_t unixtime() const { return _t; }
+  uint16_t year() const {
+    time_t t = _t;
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    return tm.tm_year + 1900;
+  }
+
+private:
+  uint32_t _t;
+};
+
+class RTC_DS3231 {
+public:
+  bool begin(TwoWire *wire = &Wire);
+  bool lostPower() { return false; }
+  DateTime now();
+  void adjust(const DateTime &dt);
+};
@@ -0,0 +1,12 @@
+#pragma once
+#include <Arduino.h>
+
+class UpdateClass {
+public:
+  bool begin(size_t) { return true; }
+  size_t write(uint8_t *, size_t len) { return len; }
+  bool end(bool = false) { return true; }
+  bool hasError() { return false; }
+  void printError(Print &) {}
+};
+extern UpdateClass Update;
@@ -0,0 +1,39 @@
+#pragma once
+#include <Arduino.h>
+
+typedef enum { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 } wl_status_t;
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass {
+public:
+  wl_status_t status();
+  void setStatus(wl_status_t s) { _status = s; }
+  bool mode(wifi_mode_t m) {
+    _mode = m;
+    return true;
+  }
+  wifi_mode_t getMode() { return _mode; }
+  bool setHostname(const char *) { return true; }
+  const char *getHostname() { return "MeterClock"; }
+  wl_status_t begin(const char *, const char * = nullptr) { return _status; }
+  void persistent(bool) {}
+  bool setSleep(bool) { return true; }
+  bool softAPConfig(IPAddress, IPAddress, IPAddress) { return true; }
+  bool softAP(const char *, const char * = nullptr, int = 1, int = 0, int = 4) {
+    return true;
+  }
+  IPAddress softAPIP() { return IPAddress(10, 5, 5, 5); }
+  String softAPmacAddress() { return "00:00:00:00:00:00"; }
+  uint8_t softAPgetStationNum() { return 0; }
+  IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+  int hostByName(const char *, IPAddress &ip) {
+    ip = IPAddress(127, 0, 0, 1);
+    return 1;
+  }
+  int8_t RSSI() { return -50; }
+
+private:
+  wl_status_t _status = WL_CONNECTED;
+  wifi_mode_t _mode = WIFI_STA;
+};
+extern WiFiClass WiFi;
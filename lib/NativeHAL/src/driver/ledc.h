@@ -0,0 +1,15 @@
+#pragma once
+// Host-side LEDC fade unit: fades complete instantly in virtual time and
+// report through the same ledcWrite tap as software writes.
+#include <esp_err.h>
+#include <stdint.h>
+
+typedef enum { LEDC_HIGH_SPEED_MODE = 0, LEDC_LOW_SPEED_MODE = 1 } ledc_mode_t;
+typedef enum { LEDC_CHANNEL_0 = 0, LEDC_CHANNEL_MAX = 8 } ledc_channel_t;
+typedef enum { LEDC_FADE_NO_WAIT = 0, LEDC_FADE_WAIT_DONE = 1 } ledc_fade_mode_t;
+
+esp_err_t ledc_fade_func_install(int intr_alloc_flags);
+esp_err_t ledc_set_fade_time_and_start(ledc_mode_t mode, ledc_channel_t channel,
+                                       uint32_t target_duty, uint32_t max_fade_time_ms,
+                                       ledc_fade_mode_t fade_mode);
+uint32_t ledc_get_duty(ledc_mode_t mode, ledc_channel_t channel);
@@ -0,0 +1,59 @@
+#pragma once
+// Host-side RMT transmitter: a write runs the translator over the whole
+// sample at once, decodes the bits back to bytes and reports them through
+// the LED tap. Transfers complete instantly.
+#include <esp_err.h>
+#include <freertos/FreeRTOS.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int gpio_num_t;
+
+typedef enum { RMT_CHANNEL_0 = 0, RMT_CHANNEL_MAX = 8 } rmt_channel_t;
+typedef enum { RMT_MODE_TX = 0, RMT_MODE_RX = 1 } rmt_mode_t;
+typedef enum { RMT_IDLE_LEVEL_LOW = 0, RMT_IDLE_LEVEL_HIGH = 1 } rmt_idle_level_t;
+
+typedef struct {
+  union {
+    struct {
+      uint32_t duration0 : 15;
+      uint32_t level0 : 1;
+      uint32_t duration1 : 15;
+      uint32_t level1 : 1;
+    };
+    uint32_t val;
+  };
+} rmt_item32_t;
+
+typedef struct {
+  bool loop_en;
+  bool carrier_en;
+  bool idle_output_en;
+  rmt_idle_level_t idle_level;
+} rmt_tx_config_t;
+
+typedef struct {
+  rmt_mode_t rmt_mode;
+  rmt_channel_t channel;
+  gpio_num_t gpio_num;
+  uint8_t clk_div;
+  uint8_t mem_block_num;
+  uint32_t flags;
+  rmt_tx_config_t tx_config;
+} rmt_config_t;
+
+#define RMT_DEFAULT_CONFIG_TX(gpio, channel_id)                                \
+  {RMT_MODE_TX, channel_id, gpio, 80, 1, 0,                                    \
+   {false, false, true, RMT_IDLE_LEVEL_LOW}}
+
+typedef void (*sample_to_rmt_t)(const void *src, rmt_item32_t *dest,
+                                size_t src_size, size_t wanted_num,
+                                size_t *translated_size, size_t *item_num);
+
+esp_err_t rmt_config(const rmt_config_t *cfg);
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rx_buf_size,
+                             int intr_alloc_flags);
+esp_err_t rmt_translator_init(rmt_channel_t channel, sample_to_rmt_t fn);
+esp_err_t rmt_write_sample(rmt_channel_t channel, const uint8_t *src,
+                           size_t src_size, bool wait_tx_done);
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, TickType_t wait_time);
@@ -0,0 +1,12 @@
+#pragma once
+#include <sys/time.h>
+
+#define SNTP_OPMODE_POLL 0
+typedef void (*sntp_sync_time_cb_t)(struct timeval *tv);
+
+bool sntp_enabled();
+void sntp_stop();
+void sntp_init();
+void sntp_setoperatingmode(int mode);
+void sntp_setservername(int idx, const char *server);
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t cb);
@@ -0,0 +1,13 @@
+#pragma once
+#include "FreeRTOS.h"
+
+// Host builds run on one thread, so taking a mutex always succeeds
+typedef void *SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+  return (SemaphoreHandle_t)1;
+}
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t, TickType_t) {
+  return pdTRUE;
+}
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t) { return pdTRUE; }
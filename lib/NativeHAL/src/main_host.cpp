@@ -0,0 +1,26 @@
+// Default host entry point: run the firmware's setup() and loop().
+// Harnesses that drive the firmware themselves provide their own main().
+//
+//   HAL_LOOPS=n     stop after n calls to loop() (default: run forever)
+//   HAL_STEP_US=us  virtual time: advance the clock by `us` per loop()
+//                   instead of following the host clock, so a run goes
+//                   as fast as the host can execute it
+// Without it each loop() is followed by advance(0), which runs the timers
+// (frames, meter tick) that came due on the host clock.
+#include "NativeHAL.h"
+
+__attribute__((weak)) int main() {
+  const char *n = getenv("HAL_LOOPS");
+  const char *step = getenv("HAL_STEP_US");
+  long loops = n ? atol(n) : -1;
+  uint64_t stepUs = step ? strtoull(step, nullptr, 10) : 0;
+  if (stepUs > 0)
+    hal::setRealtime(false);
+
+  setup();
+  for (long i = 0; loops < 0 || i < loops; i++) {
+    loop();
+    hal::advance(stepUs);
+  }
+  return 0;
+}
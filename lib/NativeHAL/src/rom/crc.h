@@ -0,0 +1,13 @@
+#pragma once
+#include <stdint.h>
+
+// Host stand-in for the ESP32 ROM CRC32 (IEEE, reflected)
+inline uint32_t crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *buf++;
+    for (uint8_t k = 0; k < 8; k++)
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
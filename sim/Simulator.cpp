@@ -0,0 +1,430 @@
+// Virtual-time simulator: runs the real setup()/loop() against the host HAL
+// clock, a year per timezone in a few seconds, and reports how well the
+// needles track ideal time and when the LED schedule switched.
+//
+//   pio run -e sim && .pio/build/sim/program
+//
+// Options (environment):
+//   SIM_TZ=Central   only this preset from timezones[] (default: all)
+//   SIM_DAYS=365     length of each run
+//   SIM_START=unix   first instant, UTC (default 2025-01-01T00:00:00Z)
+//   SIM_12H=0|1      hour scale (default 1, like Config)
+//   SIM_SMOOTH=0|1   sweeping seconds (default 0)
+//   SIM_PROFILE=n    MotionProfile (default 0, Linear)
+//   SIM_RETURN=n     ReturnMode (default 0, Normal)
+//
+// Needles always use the software ramp: the host LEDC fade completes
+// instantly, so it would hide every trajectory.
+//
+// The clock runs in 60 s steps, and in 1 ms steps for 3 s around every
+// hour and half hour (wraps, hour and DST changes land on the hour, plain
+// minute steps on the half hour). In those windows each needle change is
+// timed against the moment the ideal value changed: negative is early,
+// positive is late. Steps and wraps back to zero are reported apart. The
+// first window of each run takes in the whole minute before it, so the
+// sweep is checked from one wrap to the next.
+//
+// Before the virtual runs, setup() and a few seconds of loop() run on the
+// host clock, as the native build does, and must produce frames.
+//
+// The run fails (exit status 1) if that makes none, or if a needle breaks
+// its bounds:
+//   - sweeping seconds: phase error anywhere in the sweep (2-58 s) beyond
+//     half a PWM unit plus half a frame (SIM_PHASE_MARGIN_MS slack)
+//   - wraps: one that never lands; with Fast returns one later than the
+//     return budget, with Pre-emptive returns one off by SIM_EPISODE_MS
+//     (plus half a frame when sweeping)
+#include "NativeHAL.h"
+#include "modules/Calibration.h"
+#include "modules/Config.h"
+#include "modules/FrameScheduler.h"
+#include "modules/Meter.h"
+#include "modules/Network.h"
+#include "modules/TimeManager.h"
+#include <chrono>
+#include <vector>
+
+extern Config config;
+extern TimeManager timeManager;
+extern CalibrationTable calH;
+extern CalibrationTable calM;
+extern CalibrationTable calS;
+extern FrameScheduler frames;
+
+#define SIM_COARSE_US 60000000LL
+#define SIM_WINDOW_EVERY_US 1800000000LL
+#define SIM_WINDOW_BEFORE_MS 1500
+#define SIM_WINDOW_AFTER_MS 1500
+// First window: two minutes more. The first is warm-up, for the meters to
+// measure their latency as they would after boot, and is not counted; the
+// second is the checked sweep, between two timed wraps. It keeps the usual
+// lead-in, so it starts most of a coarse step after the last one (a move
+// timed across a short coarse jump would teach the meters that latency).
+#define SIM_WARMUP_MS 60000
+#define SIM_SWEEP_BEFORE_MS (SIM_WARMUP_MS + 60000 + SIM_WINDOW_BEFORE_MS)
+#define SIM_SETTLE_MS 500   // Window start the needles get to catch up
+#define SIM_TOLERANCE 1.0f  // PWM units counted as "on the value"
+#define SIM_JUMP 4.0f       // Smooth seconds: bigger ideal steps are wraps
+#define SIM_EPISODE_MS 5    // Changes later/earlier than this are counted
+#define SIM_MAX_LISTED 8    // Off-schedule LED transitions printed
+#define SIM_LED_DITHER 2    // LED steps this small are dithering, not changes
+#define SIM_LED_QUIET_US 120000000LL // Changes closer than this are one fade
+#define SIM_PHASE_MARGIN_MS 5.0
+#define SIM_REALTIME_MS 3000  // Host-clock run before the virtual ones
+#define SIM_REALTIME_FRAMES 2 // Frames it must make, at least
+
+static const char *METER_NAMES[3] = {"hour", "minute", "second"};
+static const uint8_t METER_CHANNELS[3] = {0, 1, 2};
+
+struct ChangeStats {
+  uint32_t changes = 0;
+  uint32_t missed = 0; // Never arrived inside the window
+  int64_t sumAbsMs = 0;
+  int32_t worstMs = 0;
+  time_t worstAt = 0;
+  uint32_t episodes = 0;
+};
+
+struct NeedleStats {
+  ChangeStats steps;
+  ChangeStats wraps; // Ideal value went backwards (59->0, 12->1)
+  // Smooth seconds only: phase error between wraps
+  double phaseSum = 0;
+  double phaseWorst = 0;
+  uint64_t phaseSamples = 0;
+};
+
+// A fade counts once, at its first step; rgb is where it settled
+struct LedTransition {
+  time_t at;
+  uint32_t rgb;
+};
+
+struct SimRun {
+  NeedleStats needles[3];
+  std::vector<LedTransition> leds;
+  int16_t ledRef[3] = {-100, -100, -100};
+  int64_t ledChangeUs = 0;
+};
+
+static SimRun *s_run = nullptr;
+static uint32_t s_failures = 0;
+
+static int64_t wallMicros() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+}
+
+static String formatLocal(time_t t, bool seconds) {
+  struct tm lt;
+  localtime_r(&t, &lt);
+  char buf[32];
+  strftime(buf, sizeof(buf), seconds ? "%Y-%m-%d %H:%M:%S %Z" : "%Y-%m-%d %H:%M",
+           &lt);
+  return String(buf);
+}
+
+// What each meter should show at wall time `us`, mirroring loop()
+static void idealValues(int64_t us, bool smooth, float out[3]) {
+  static time_t lastSec = -1;
+  static struct tm lt;
+  time_t sec = us / 1000000LL;
+  if (sec != lastSec) {
+    localtime_r(&sec, &lt);
+    lastSec = sec;
+  }
+  int hour = lt.tm_hour;
+  if (config.get12H()) {
+    hour %= 12;
+    if (hour == 0)
+      hour = 12;
+  }
+  float s = lt.tm_sec;
+  if (smooth)
+    s += (us % 1000000LL) / 1000000.0f;
+  out[0] = calH.map(hour);
+  out[1] = calM.map(lt.tm_min);
+  out[2] = calS.map(s);
+}
+
+static void advanceTo(int64_t wallUs, int64_t stepUs) {
+  for (int64_t now = wallMicros(); now < wallUs; now = wallMicros()) {
+    loop();
+    hal::advance(min(stepUs, wallUs - now));
+  }
+}
+
+// Time every change of the ideal value inside one dense window; the first
+// settleMs only show when the needles got back on the value
+static void analyseWindow(SimRun &run, int64_t startUs, size_t settleMs,
+                          const std::vector<float> *ideal,
+                          const std::vector<uint16_t> *duty, bool smooth) {
+  size_t n = duty[0].size();
+  for (uint8_t m = 0; m < 3; m++) {
+    NeedleStats &st = run.needles[m];
+    bool continuous = smooth && m == 2;
+    float slope = calS.map(30.5f) - calS.map(29.5f); // Units per second
+    // Phase is sampled away from the wrap, where returns and the needle
+    // falling in with the sweep again (S-Curve) don't interfere
+    float sweepLo = calS.map(2.0f), sweepHi = calS.map(58.0f);
+    size_t prev = SIM_SETTLE_MS;
+
+    for (size_t c = SIM_SETTLE_MS + 1; c < n; c++) {
+      float step = ideal[m][c] - ideal[m][c - 1];
+      bool change = continuous ? fabsf(step) > SIM_JUMP : step != 0;
+      if (!change) {
+        if (continuous && c > prev && c > settleMs &&
+            ideal[m][c] >= sweepLo && ideal[m][c] <= sweepHi && slope > 0) {
+          // Sweep: how far (in ms) the needle is ahead of true time
+          double err = (duty[m][c] - ideal[m][c]) / slope * 1000.0;
+          st.phaseSum += fabs(err);
+          st.phaseSamples++;
+          if (fabs(err) > fabs(st.phaseWorst))
+            st.phaseWorst = err;
+        }
+        continue;
+      }
+
+      // A sweeping needle has arrived once it is back on the moving value
+      ChangeStats &cs = step < 0 ? st.wraps : st.steps;
+      float target = ideal[m][c];
+      auto onValue = [&](size_t i) {
+        float want = continuous ? ideal[m][i] : target;
+        return fabsf(duty[m][i] - want) <= SIM_TOLERANCE;
+      };
+      size_t a = c;
+      if (onValue(c)) {
+        while (a > prev + 1 && onValue(a - 1))
+          a--;
+      } else {
+        while (a < n && !onValue(a))
+          a++;
+      }
+      prev = max(a, c); // Phase is only sampled once the needle is back
+      if (c <= settleMs)
+        continue;
+      cs.changes++;
+      if (a >= n) {
+        cs.missed++;
+        continue;
+      }
+
+      int32_t errMs = (int32_t)a - (int32_t)c;
+      cs.sumAbsMs += abs(errMs);
+      if (abs(errMs) > SIM_EPISODE_MS)
+        cs.episodes++;
+      if (abs(errMs) > abs(cs.worstMs)) {
+        cs.worstMs = errMs;
+        cs.worstAt = (startUs + (int64_t)c * 1000) / 1000000LL;
+      }
+    }
+  }
+}
+
+static void printChanges(const char *name, const char *kind,
+                         const ChangeStats &cs) {
+  uint32_t arrived = cs.changes - cs.missed;
+  printf("  %-7s %s %6u, mean |err| %5.1f ms, worst %+5d ms", name, kind,
+         (unsigned)cs.changes, arrived ? (double)cs.sumAbsMs / arrived : 0.0,
+         (int)cs.worstMs);
+  if (cs.worstMs != 0)
+    printf(" at %s", formatLocal(cs.worstAt, true).c_str());
+  printf(", %u over %d ms", (unsigned)cs.episodes, SIM_EPISODE_MS);
+  if (cs.missed)
+    printf(", %u never arrived", (unsigned)cs.missed);
+  printf("\n");
+}
+
+static void fail(const char *name, const char *what, double got,
+                 double limit) {
+  printf("  FAIL    %s %s %+.1f ms, limit %.1f ms\n", name, what, got, limit);
+  s_failures++;
+}
+
+static void checkBounds(const SimRun &run, bool smooth) {
+  // A held duty is up to half a unit off, and a smooth target is aimed at
+  // the middle of the frame it is held for
+  float slope = calS.map(30.5f) - calS.map(29.5f); // Units per second
+  double phaseLimit = 500.0 / slope + 500.0 / FRAME_FPS_SMOOTH +
+                      SIM_PHASE_MARGIN_MS;
+  const NeedleStats &sec = run.needles[2];
+  if (smooth && sec.phaseSamples == 0)
+    fail("second", "sweep not sampled", 0, 0);
+  if (smooth && fabs(sec.phaseWorst) > phaseLimit)
+    fail("second", "sweep phase error", sec.phaseWorst, phaseLimit);
+
+  // Sweeping, the stepped needles flip on the frame nearest the boundary
+  ReturnMode ret = (ReturnMode)config.getReturnMode();
+  int32_t wrapLimit = SIM_EPISODE_MS + (smooth ? 500 / FRAME_FPS_SMOOTH : 0);
+  for (uint8_t m = 0; m < 3; m++) {
+    const ChangeStats &w = run.needles[m].wraps;
+    if (w.missed)
+      fail(METER_NAMES[m], "wraps never landed", w.missed, 0);
+    if (ret == ReturnMode::Fast &&
+        w.worstMs > config.getReturnBudgetMs(m))
+      fail(METER_NAMES[m], "wrap landed", w.worstMs,
+           config.getReturnBudgetMs(m));
+    if (ret == ReturnMode::Preemptive && abs(w.worstMs) > wrapLimit)
+      fail(METER_NAMES[m], "wrap landed", w.worstMs, wrapLimit);
+  }
+}
+
+static void runTimezone(const TZOption &tz, time_t start, int days,
+                        bool smooth) {
+  SimRun run;
+  s_run = &run;
+
+  config.saveTimezone(tz.posix);
+  config.dispatch(); // Applies the TZ before the first ideal sample
+  hal::setWallClock(start, 0);
+
+  std::vector<float> ideal[3];
+  std::vector<uint16_t> duty[3];
+
+  int64_t end = (int64_t)(start + days * 86400LL) * 1000000LL;
+  int64_t first = (int64_t)(start + 1800) * 1000000LL;
+  for (int64_t at = first; at < end; at += SIM_WINDOW_EVERY_US) {
+    size_t beforeMs = at == first ? SIM_SWEEP_BEFORE_MS : SIM_WINDOW_BEFORE_MS;
+    size_t windowMs = beforeMs + SIM_WINDOW_AFTER_MS;
+    for (uint8_t m = 0; m < 3; m++) {
+      ideal[m].resize(windowMs);
+      duty[m].resize(windowMs);
+    }
+    int64_t windowStart = at - beforeMs * 1000LL;
+    advanceTo(windowStart, SIM_COARSE_US);
+
+    for (size_t i = 0; i < windowMs; i++) {
+      loop();
+      hal::advance(1000);
+      float values[3];
+      idealValues(windowStart + (int64_t)(i + 1) * 1000, smooth, values);
+      for (uint8_t m = 0; m < 3; m++) {
+        ideal[m][i] = values[m];
+        duty[m][i] = hal::ledcDuty(METER_CHANNELS[m]);
+      }
+    }
+    size_t settleMs = SIM_SETTLE_MS + (at == first ? SIM_WARMUP_MS : 0);
+    analyseWindow(run, windowStart + 1000, settleMs, ideal, duty, smooth);
+  }
+  advanceTo(end, SIM_COARSE_US);
+
+  // Report
+  printf("%s (%s)\n", tz.name, tz.posix);
+  for (uint8_t m = 0; m < 3; m++) {
+    NeedleStats &st = run.needles[m];
+    printChanges(METER_NAMES[m], "steps", st.steps);
+    printChanges("", "wraps", st.wraps);
+    if (st.phaseSamples)
+      printf("  %-7s sweep phase error mean %.1f ms, worst %+.1f ms\n", "",
+             st.phaseSum / st.phaseSamples, st.phaseWorst);
+  }
+  checkBounds(run, smooth);
+
+  // A transition is on schedule if it starts in a keyframe's minute
+  const LightSchedulePoints &sched = config.getLightSchedule();
+  auto onSchedule = [&](time_t at) {
+    struct tm lt;
+    localtime_r(&at, &lt);
+    int min = lt.tm_hour * 60 + lt.tm_min;
+    for (uint8_t k = 0; k < sched.count; k++)
+      if (sched.keys[k].minute == min)
+        return true;
+    return false;
+  };
+  uint32_t offSchedule = 0;
+  for (size_t i = 1; i < run.leds.size(); i++)
+    if (!onSchedule(run.leds[i].at))
+      offSchedule++;
+  printf("  leds    %u transitions (%u keyframes), %u off schedule\n",
+         (unsigned)(run.leds.size() > 0 ? run.leds.size() - 1 : 0),
+         (unsigned)sched.count, (unsigned)offSchedule);
+  uint32_t listed = 0;
+  for (size_t i = 1; i < run.leds.size() && listed < SIM_MAX_LISTED; i++) {
+    if (onSchedule(run.leds[i].at))
+      continue;
+    printf("          %s -> #%06X\n",
+           formatLocal(run.leds[i].at, false).c_str(),
+           (unsigned)run.leds[i].rgb);
+    listed++;
+  }
+  s_run = nullptr;
+}
+
+// The esp_timer callbacks (frames, meter tick) have to fire on the host
+// clock too, not only when a simulator advances virtual time
+static void checkRealtime() {
+  uint64_t start = hal::nowMicros();
+  while (hal::nowMicros() - start < SIM_REALTIME_MS * 1000ULL) {
+    loop();
+    hal::advance(0);
+  }
+  uint32_t made = frames.getStats().frames;
+  printf("Realtime: %u frames in %u ms\n\n", (unsigned)made,
+         (unsigned)SIM_REALTIME_MS);
+  if (made < SIM_REALTIME_FRAMES) {
+    printf("  FAIL    realtime frames %u, need %u\n\n", (unsigned)made,
+           (unsigned)SIM_REALTIME_FRAMES);
+    s_failures++;
+  }
+}
+
+static int envInt(const char *name, int fallback) {
+  const char *v = getenv(name);
+  return v ? atoi(v) : fallback;
+}
+
+int main() {
+  hal::setSerialOutput(false);
+  hal::onLedShow([](const uint8_t *rgb, int count, uint8_t) {
+    if (!s_run || count == 0)
+      return;
+    bool changed = false;
+    for (uint8_t c = 0; c < 3; c++)
+      changed |= abs(rgb[c] - s_run->ledRef[c]) > SIM_LED_DITHER;
+    if (!changed)
+      return;
+    for (uint8_t c = 0; c < 3; c++)
+      s_run->ledRef[c] = rgb[c];
+
+    uint32_t color = ((uint32_t)rgb[0] << 16) | (rgb[1] << 8) | rgb[2];
+    int64_t now = wallMicros();
+    if (s_run->leds.empty() || now - s_run->ledChangeUs > SIM_LED_QUIET_US)
+      s_run->leds.push_back({(time_t)(now / 1000000LL), color});
+    else
+      s_run->leds.back().rgb = color;
+    s_run->ledChangeUs = now;
+  });
+
+  setup();
+  checkRealtime();
+  hal::setRealtime(false);
+
+  const char *only = getenv("SIM_TZ");
+  int days = envInt("SIM_DAYS", 365);
+  const char *startEnv = getenv("SIM_START");
+  time_t start = startEnv ? (time_t)atoll(startEnv) : 1735689600; // 2025-01-01
+  bool smooth = envInt("SIM_SMOOTH", 0);
+
+  config.saveMeterDrive((uint8_t)MeterDrive::Software);
+  config.saveMotionProfile(envInt("SIM_PROFILE", 0));
+  config.saveReturnMode(envInt("SIM_RETURN", 0));
+  config.save12H(envInt("SIM_12H", 1));
+  config.saveSmoothSeconds(smooth);
+
+  printf("%d days from %ld, %s, %s seconds, profile %d, return mode %d\n\n",
+         days, (long)start, config.get12H() ? "12H" : "24H",
+         smooth ? "sweeping" : "ticking", config.getMotionProfile(),
+         config.getReturnMode());
+  for (size_t i = 0; i < timezoneCount; i++) {
+    if (only && strcmp(only, timezones[i].name) != 0)
+      continue;
+    auto t0 = std::chrono::steady_clock::now();
+    runTimezone(timezones[i], start, days, smooth);
+    std::chrono::duration<double> took = std::chrono::steady_clock::now() - t0;
+    printf("  (%.1f s)\n\n", took.count());
+  }
+  if (s_failures)
+    printf("%u checks failed\n", (unsigned)s_failures);
+  return s_failures ? 1 : 0;
+}
@@ -1,14 +1,21 @@
+#include "modules/Calibration.h"
+#include "modules/Commands.h"
 #include "modules/Config.h"
+#include "modules/FrameScheduler.h"
 #include "modules/GlobalState.h"
+#include "modules/LightSchedule.h"
 #include "modules/Lighting.h"
 #include "modules/Meter.h"
 #include "modules/Network.h"
+#include "modules/Preview.h"
+#include "modules/Profiler.h"
+#include "modules/Tasks.h"
+#include "modules/Telemetry.h"
 #include "modules/TimeManager.h"
 #include <Arduino.h>
 
 // Global State Definitions
-bool g_isCalibrationMode = false;
-int g_calOverrideValues[3] = {-1, -1, -1};
+Snapshot<CalibrationOverride> g_calibration({false, {-1, -1, -1}});
 
 // Hardware Pin Configuration
 #define PIN_METER_H 25
@@ -28,6 +35,119 @@ Meter meterS(PIN_METER_S, 2);
 
 Lighting lighting;
 
+TaskManager tasks;
+FrameScheduler frames;
+CommandQueue commands;
+Profiler perf;
+Telemetry telemetry;
+Preview preview;
+
+CalibrationTable calH;
+CalibrationTable calM;
+CalibrationTable calS;
+
+ScheduleTable lightSchedule;
+
+// Meter task: runs every METER_TASK_PERIOD_US and owns the needles
+void meterTick() {
+  uint32_t t0 = perf.start();
+  meterH.update();
+  perf.record(PerfStage::MeterH, t0);
+  t0 = perf.start();
+  meterM.update();
+  perf.record(PerfStage::MeterM, t0);
+  t0 = perf.start();
+  meterS.update();
+  perf.record(PerfStage::MeterS, t0);
+}
+
+// Housekeeping task: DNS (run as often as possible), telemetry, RTC sync,
+// LED frames and settings writes
+void housekeeping() {
+  uint32_t t0 = perf.start();
+  network.loop();
+  telemetry.loop();
+  perf.record(PerfStage::Network, t0);
+  t0 = perf.start();
+  timeManager.update();
+  perf.record(PerfStage::Time, t0);
+  t0 = perf.start();
+  if (lighting.refresh())
+    perf.record(PerfStage::LedFrame, t0);
+  config.loop();
+}
+
+// Config listeners: derived state is rebuilt only when its settings change,
+// from the frame loop (Config::dispatch()), so they read config.view()
+
+// Compile the calibration points into fixed-point tables
+void rebuildCalibration(uint32_t) {
+  const ConfigBlob &c = config.view();
+  calH.build(c.cal.points(CAL_METER_H), c.cal.count[CAL_METER_H],
+             c.is12h ? 12 : 24);
+  calM.build(c.cal.points(CAL_METER_M), c.cal.count[CAL_METER_M], 60);
+  calS.build(c.cal.points(CAL_METER_S), c.cal.count[CAL_METER_S], 60);
+}
+
+void rebuildLighting(uint32_t) {
+  lightSchedule.build(config.view().schedule);
+  lighting.setCount(config.view().ledCount);
+}
+
+// The time source as last applied to the clock. Seeded from the saved
+// settings in setup(), so the first frame doesn't set the clock back to a
+// stale manual time or restart SNTP.
+bool appliedUseNTP;
+char appliedNTP[sizeof(ConfigBlob::ntp)];
+uint64_t appliedManualTime;
+
+// Zone, and the source when the saved one moves on from what was applied:
+// SNTP restarts for a new server, a new manual time sets the clock unless
+// NTP is on
+void applyTime(uint32_t) {
+  timeManager.applyTimezone();
+  const ConfigBlob &c = config.view();
+  if (c.useNTP != appliedUseNTP ||
+      (c.useNTP && strcmp(c.ntp, appliedNTP) != 0)) {
+    appliedUseNTP = c.useNTP;
+    strlcpy(appliedNTP, c.ntp, sizeof(appliedNTP));
+    timeManager.setUseNTP(c.useNTP);
+  }
+  if (c.manualTime != appliedManualTime) {
+    appliedManualTime = c.manualTime;
+    if (!c.useNTP)
+      timeManager.setManualTime((time_t)c.manualTime);
+  }
+}
+
+// Needle drive mode (falls back to software if the fade unit fails),
+// profile and wrap returns
+void applyMotion(uint32_t) {
+  const ConfigBlob &c = config.view();
+  MotionProfile profile = (MotionProfile)c.motionProfile;
+  MeterDrive drive = (MeterDrive)c.meterDrive;
+  // The fade unit only slews linearly: any other profile needs the
+  // software ramp. The setting is kept for when Linear is picked again.
+  if (profile != MotionProfile::Linear)
+    drive = MeterDrive::Software;
+  if (meterH.getDrive() != drive) {
+    if (!meterH.setDrive(drive)) {
+      drive = MeterDrive::Software;
+      config.saveMeterDrive((uint8_t)drive);
+    }
+    meterM.setDrive(drive);
+    meterS.setDrive(drive);
+  }
+  meterH.setProfile(profile);
+  meterM.setProfile(profile);
+  meterS.setProfile(profile);
+
+  ReturnMode ret = (ReturnMode)c.returnMode;
+  meterH.setReturn(ret, c.returnSlew, c.returnBudgetMs[CAL_METER_H]);
+  meterM.setReturn(ret, c.returnSlew, c.returnBudgetMs[CAL_METER_M]);
+  meterS.setReturn(ret, c.returnSlew, c.returnBudgetMs[CAL_METER_S]);
+}
+
 void setup() {
   Serial.begin(115200);
   Serial.println("Starting Analog Meter Clock...");
@@ -45,87 +165,216 @@ void setup() {
   meterH.begin();
   meterM.begin();
   meterS.begin();
-  lighting.begin();
+  lighting.begin(config.getLedCount());
 
   // 3. Network
   network.begin(); // connects to WiFi or AP
 
   // 4. Time
   timeManager.begin(); // Syncs NTP/RTC
+
+  // 5. Tasks (meters on their own core, network/housekeeping on the other)
+  tasks.begin(meterTick, housekeeping);
+
+  // 6. Settings listeners, all run by the first frame
+  config.onChange(CONFIG_SECTION(Calibration) | CONFIG_SECTION(Display),
+                  rebuildCalibration);
+  config.onChange(CONFIG_SECTION(Lighting), rebuildLighting);
+  appliedUseNTP = config.view().useNTP;
+  strlcpy(appliedNTP, config.view().ntp, sizeof(appliedNTP));
+  appliedManualTime = config.view().manualTime;
+  config.onChange(CONFIG_SECTION(Time), applyTime);
+  config.onChange(CONFIG_SECTION(Motion), applyMotion);
+
+  // 7. Frames (aligned to the wall-clock second)
+  frames.begin();
 }
 
-// Piecewise linear mapping
-float mapPiecewise(float x, float in_min, float in_mid, float in_max, float out_min,
-                  float out_mid, float out_max) {
-  if (x <= in_mid) {
-    return (x - in_min) * (out_mid - out_min) / (in_mid - in_min) + out_min;
-  } else {
-    return (x - in_mid) * (out_max - out_mid) / (in_max - in_mid) + out_mid;
+// Web requests that touch the hardware or the radio: applied
+// here at the frame boundary rather than in the async_tcp callbacks
+unsigned long restartAtMs = 0; // 0 = no restart pending
+
+void applyCommands() {
+  Command cmd;
+  while (commands.pop(cmd)) {
+    switch (cmd.type) {
+    case CommandType::CalibrationMode:
+      // Clear the overrides when the mode changes
+      g_calibration.publish({cmd.arg != 0, {-1, -1, -1}});
+      break;
+    case CommandType::Restart:
+      restartAtMs = max(millis() + (unsigned long)cmd.arg, 1UL);
+      break;
+    case CommandType::WiFiTest:
+      network.testStation(cmd.arg != 0);
+      break;
+    }
+    commands.recordApplied(cmd);
+  }
+
+  if (restartAtMs && (long)(millis() - restartAtMs) >= 0) {
+    Serial.println("Restarting...");
+    config.flush();
+    ESP.restart();
+  }
+}
+
+// Calibration preview: only the newest value per needle since the last
+// frame, however many the page sent
+void applyPreview() {
+  CalibrationOverride cal = g_calibration.read();
+  bool changed = false;
+  for (uint8_t i = CAL_METER_H; i <= CAL_METER_S; i++) {
+    int16_t value;
+    if (preview.takeCalibration(i, value) && cal.active) {
+      cal.value[i] = value;
+      changed = true;
+    }
   }
+  if (changed)
+    g_calibration.publish(cal);
+}
+
+// Configured latency, else measured on the needle, else the motion model
+uint32_t meterLatencyUs(Meter &meter, uint8_t index, float step) {
+  uint32_t us = config.view().meterLatencyUs[index];
+  if (us == 0)
+    us = meter.getMeasuredLatencyUs();
+  if (us == 0)
+    us = meter.estimateLatencyUs(step);
+  return us;
+}
+
+// Pre-emptive return: tell each meter when its scale next wraps, early
+// enough that the return can start before the frame on the boundary
+#define WRAP_ARM_WINDOW_S 2.0f
+
+void armWrap(Meter &meter, unsigned long landing, float secondsToWrap,
+             float value) {
+  if (secondsToWrap < WRAP_ARM_WINDOW_S)
+    meter.armWrap(landing + (unsigned long)(secondsToWrap * 1000000.0f),
+                  value);
+}
+
+void armWraps() {
+  const TimeSnapshot &t = timeManager.snapshot();
+  if (!t.valid)
+    return;
+  unsigned long landing = micros() + frames.getAheadUs();
+  float toMinute = 60.0f - t.second;
+  float toHour = (60.0f - t.minute) * 60.0f;
+  armWrap(meterS, landing, toMinute, calS.map(0));
+  armWrap(meterM, landing, toHour, calM.map(0));
+
+  // The hour scale wraps 12->1 (12H) or 23->0 (24H)
+  bool h12 = config.view().is12h;
+  if (h12 ? timeManager.getHour(t) == 12 : t.local.tm_hour == 23)
+    armWrap(meterH, landing, toHour, calH.map(h12 ? 1 : 0));
 }
 
 void loop() {
-  // 1. Update Network (Run this as often as possible for DNS)
-  network.loop();
-  timeManager.update();
+  // 1. Meters, Network and RTC run from TaskManager (or here, cooperatively)
+  tasks.poll();
+
+  // 2. Logic & UI Updates, once per frame (on the second, or 20Hz)
+  if (frames.wait(FRAME_WAIT_MS)) {
+    uint32_t frameStart = perf.start();
+    bool hadLead = frames.getAheadUs() > 0;
 
-  // Check UTC Switch (Active Low)
-  timeManager.setOverrideUTC(digitalRead(PIN_TZ_SWITCH) == LOW);
+    // Rebuild whatever the web pages changed since the last frame, then
+    // carry out their requests and show their previews
+    config.dispatch();
+    applyCommands();
+    applyPreview();
 
-  // 2. Logic & UI Updates (Throttled to avoid starving Network/Interrupts)
-  static unsigned long lastUpdate = 0;
-  if (millis() - lastUpdate > 50) { // 20Hz update rate
-    lastUpdate = millis();
+    // Check UTC Switch (Active Low)
+    timeManager.setOverrideUTC(digitalRead(PIN_TZ_SWITCH) == LOW);
 
-    // Get Time
-    float h = timeManager.getHour();
-    float m = timeManager.getMinute();
-    float s = config.getSmoothSeconds() ? timeManager.getExactSecond() : timeManager.getSecond();
+    uint32_t mappingStart = perf.start();
+
+    // Get Time as of when the frame lands (one TZ conversion per frame),
+    // then aim each meter at the time its needle will get there. A smooth
+    // target is held for a whole frame, so aim it at the middle of it.
+    static uint32_t latencyUs[3] = {0, 0, 0};
+    bool smoothSeconds = config.view().smoothSeconds;
+    int32_t ahead = frames.getAheadUs();
+    if (smoothSeconds)
+      ahead -= 500000 / frames.getFramesPerSecond();
+    timeManager.capture(frames.getAheadUs());
+    TimeSnapshot atH =
+        timeManager.project(latencyUs[CAL_METER_H] - ahead, !smoothSeconds);
+    TimeSnapshot atM =
+        timeManager.project(latencyUs[CAL_METER_M] - ahead, !smoothSeconds);
+    TimeSnapshot atS =
+        timeManager.project(latencyUs[CAL_METER_S] - ahead, !smoothSeconds);
+    float h = timeManager.getHour(atH);
+    float m = atM.valid ? atM.local.tm_min : 0;
+    float s = !atS.valid ? 0 : (smoothSeconds ? atS.second : atS.local.tm_sec);
 
     // Logic: Map Time to Meters (with Calibration)
     float valH = 0;
     float valM = 0;
     float valS = 0;
 
-    if (g_isCalibrationMode) {
+    CalibrationOverride calOverride = g_calibration.read();
+    if (calOverride.active) {
       // Direct Calibration Override
-      if (millis() % 1000 == 0)
-        Serial.println("In Calibration Mode Loop"); // Debug
-      valH = (g_calOverrideValues[0] != -1) ? g_calOverrideValues[0] : 0;
-      valM = (g_calOverrideValues[1] != -1) ? g_calOverrideValues[1] : 0;
-      valS = (g_calOverrideValues[2] != -1) ? g_calOverrideValues[2] : 0;
+      valH = (calOverride.value[0] != -1) ? calOverride.value[0] : 0;
+      valM = (calOverride.value[1] != -1) ? calOverride.value[1] : 0;
+      valS = (calOverride.value[2] != -1) ? calOverride.value[2] : 0;
     } else {
       // Standard Time Mode with Piecewise Linear Mapping
-      if (config.get12H()) {
-        valH = mapPiecewise(h, 0, 6, 12, config.getCalHMin(),
-                            config.getCalHMid(), config.getCalHMax());
-      } else {
-        valH = mapPiecewise(h, 0, 12, 24, config.getCalHMin(),
-                            config.getCalHMid(), config.getCalHMax());
-      }
-      valM = mapPiecewise(m, 0, 30, 60, config.getCalMMin(),
-                          config.getCalMMid(), config.getCalMMax());
-      valS = mapPiecewise(s, 0, 30, 60, config.getCalSMin(),
-                          config.getCalSMid(), config.getCalSMax());
+      valH = calH.map(h);
+      valM = calM.map(m);
+      valS = calS.map(s);
     }
 
+    // Scale wrap returns
+    if ((ReturnMode)config.view().returnMode == ReturnMode::Preemptive &&
+        !calOverride.active)
+      armWraps();
+
     // Update Outputs (Target)
     meterH.setTarget(valH);
     meterM.setTarget(valM);
     meterS.setTarget(valS);
+    perf.record(PerfStage::Mapping, mappingStart);
 
     // Verify Connection State
     bool isConnected = (WiFi.status() == WL_CONNECTED);
     bool isTimeSet = timeManager.isTimeSet();
     bool showConnectionError = (!isConnected && !isTimeSet);
 
-    // Update Lighting
-    lighting.update(timeManager.getHour24(), m, config, showConnectionError);
-    lighting.show();
-  }
+    // Update Lighting, at the minute the minute needle shows
+    uint32_t t0 = perf.start();
+    uint16_t minuteOfDay =
+        atM.valid ? atM.local.tm_hour * 60 + atM.local.tm_min : 0;
+    const LightKeyframe &look = lightSchedule.at(minuteOfDay);
+    lighting.update(look, showConnectionError);
+    perf.record(PerfStage::Lighting, t0);
 
-  // Fast loop for smooth ramping
-  meterH.update();
-  meterM.update();
-  meterS.update();
+    // What this frame did, for /ws/telemetry
+    telemetry.publishFrame({timeManager.snapshot(), look, showConnectionError,
+                            config.view().useNTP});
+
+    // Next frame: sub-frames only when something moves between seconds
+    bool smooth = smoothSeconds || calOverride.active || showConnectionError;
+    uint8_t fps = smooth ? FRAME_FPS_SMOOTH : FRAME_FPS_TICK;
+    frames.setFramesPerSecond(fps);
+
+    // Needle latencies for the next frame; the second needle's sets the lead
+    float step = smoothSeconds ? 1.0f / fps : 1.0f;
+    latencyUs[CAL_METER_H] =
+        meterLatencyUs(meterH, CAL_METER_H, calH.map(1) - calH.map(0));
+    latencyUs[CAL_METER_M] =
+        meterLatencyUs(meterM, CAL_METER_M, calM.map(1) - calM.map(0));
+    latencyUs[CAL_METER_S] =
+        meterLatencyUs(meterS, CAL_METER_S, calS.map(step) - calS.map(0));
+    frames.setLeadUs(latencyUs[CAL_METER_S]);
+
+    // Overrun: the frame started ahead of its boundary but finished after it
+    if (hadLead && frames.getAheadUs() <= 0)
+      perf.recordOverrun();
+    perf.record(PerfStage::Frame, frameStart);
+  }
 } // End loop
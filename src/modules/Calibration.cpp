@@ -0,0 +1,42 @@
+#include "Calibration.h"
+
+CalibrationTable::CalibrationTable() : _scale(0), _segments(0) {
+  memset(_base, 0, sizeof(_base));
+  memset(_slope, 0, sizeof(_slope));
+}
+
+void CalibrationTable::build(const uint16_t *points, uint8_t count,
+                             float span) {
+  if (count > MAX_POINTS)
+    count = MAX_POINTS;
+  if (count < 2 || span <= 0.0f) {
+    _segments = 0;
+    return;
+  }
+
+  _segments = count - 1;
+  _scale = (uint32_t)(_segments * 16777216.0 / span + 0.5);
+  for (uint8_t i = 0; i < _segments; i++) {
+    _base[i] = (int32_t)points[i] << 16;
+    _slope[i] = (int32_t)points[i + 1] - (int32_t)points[i];
+  }
+  // Sentinel so x == span lands exactly on the last point
+  _base[_segments] = (int32_t)points[_segments] << 16;
+  _slope[_segments] = 0;
+}
+
+int32_t CalibrationTable::mapQ16(int32_t x) const {
+  if (_segments == 0)
+    return 0;
+  if (x < 0)
+    x = 0;
+
+  // Q16 segment units; 24 h << 16 times a Q24 scale needs the 64 bits
+  uint64_t xs = ((uint64_t)x * _scale) >> 24;
+  if (xs >= ((uint64_t)_segments << 16))
+    return _base[_segments];
+  uint32_t idx = (uint32_t)xs >> 16;
+
+  // |slope| <= 1023 and frac < 65536, so this fits in 32 bits
+  return _base[idx] + _slope[idx] * (int32_t)(xs & 0xFFFF);
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <Arduino.h>
+
+// Meter calibration compiled to a fixed-point lookup table.
+// Calibration points are evenly spaced over the input span (e.g. 0/30/60
+// seconds, or one per second mark). build() precomputes a Q16 base and an
+// integer slope for each segment and a fixed-point input scale, so mapQ16()
+// is integer only: one scale multiply and one multiply-add, with no
+// division and no Config reads per frame. The cost is the same for 2
+// points or 61.
+class CalibrationTable {
+public:
+  static const uint8_t MAX_POINTS = 61;
+
+  CalibrationTable();
+
+  // points: PWM value at each evenly spaced input step, span: input range
+  void build(const uint16_t *points, uint8_t count, float span);
+
+  // x in Q16 input units (e.g. seconds << 16), PWM value in Q16
+  int32_t mapQ16(int32_t x) const;
+  float map(float x) const {
+    return mapQ16((int32_t)(x * 65536.0f)) * (1.0f / 65536.0f);
+  }
+
+private:
+  // Input units -> segment units, Q24: at Q16 the rounding alone would put
+  // the end of a 60 s span up to half a PWM unit off
+  uint32_t _scale;
+  uint8_t _segments;
+  int32_t _base[MAX_POINTS]; // Q16 PWM at the start of each segment
+  int32_t _slope[MAX_POINTS]; // PWM delta across each segment
+};
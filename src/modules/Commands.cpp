@@ -0,0 +1,83 @@
+#include "Commands.h"
+
+static_assert((COMMAND_QUEUE_DEPTH & (COMMAND_QUEUE_DEPTH - 1)) == 0,
+              "COMMAND_QUEUE_DEPTH must be a power of two");
+
+#define COMMAND_QUEUE_MASK (COMMAND_QUEUE_DEPTH - 1)
+
+CommandQueue::CommandQueue()
+    : _head(0), _tail(0), _pushed(0), _dropped(0), _maxDepth(0), _applied(0),
+      _maxLatencyUs(0), _sumLatencyUs(0) {
+  // Slot i is free for the producer that claims position i
+  for (uint32_t i = 0; i < COMMAND_QUEUE_DEPTH; i++)
+    _slots[i].seq.store(i, std::memory_order_relaxed);
+}
+
+bool CommandQueue::push(CommandType type, int64_t arg, uint8_t index) {
+  uint32_t pos = _head.load(std::memory_order_relaxed);
+  Slot *slot;
+  for (;;) {
+    slot = &_slots[pos & COMMAND_QUEUE_MASK];
+    int32_t diff =
+        (int32_t)(slot->seq.load(std::memory_order_acquire) - pos);
+    if (diff == 0) {
+      // Free: claim it (on failure pos is reloaded and we go round again)
+      if (_head.compare_exchange_weak(pos, pos + 1,
+                                      std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      // Still holds the command from a lap ago: full
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      pos = _head.load(std::memory_order_relaxed);
+    }
+  }
+
+  slot->cmd.type = type;
+  slot->cmd.index = index;
+  slot->cmd.arg = arg;
+  slot->cmd.queuedUs = micros();
+  slot->seq.store(pos + 1, std::memory_order_release); // Ready to read
+
+  _pushed.fetch_add(1, std::memory_order_relaxed);
+  uint32_t depth = pos + 1 - _tail.load(std::memory_order_relaxed);
+  uint32_t max = _maxDepth.load(std::memory_order_relaxed);
+  while (depth > max && !_maxDepth.compare_exchange_weak(
+                            max, depth, std::memory_order_relaxed)) {
+  }
+  return true;
+}
+
+bool CommandQueue::pop(Command &out) {
+  uint32_t pos = _tail.load(std::memory_order_relaxed);
+  Slot &slot = _slots[pos & COMMAND_QUEUE_MASK];
+  if (slot.seq.load(std::memory_order_acquire) != pos + 1)
+    return false; // Empty, or the producer hasn't finished writing it
+
+  out = slot.cmd;
+  slot.seq.store(pos + COMMAND_QUEUE_DEPTH, std::memory_order_release);
+  _tail.store(pos + 1, std::memory_order_relaxed);
+  return true;
+}
+
+void CommandQueue::recordApplied(const Command &cmd) {
+  uint32_t latency = micros() - cmd.queuedUs;
+  if (latency > _maxLatencyUs)
+    _maxLatencyUs = latency;
+  _sumLatencyUs += latency;
+  _applied++;
+}
+
+CommandStats CommandQueue::getStats() const {
+  CommandStats s;
+  s.pushed = _pushed.load(std::memory_order_relaxed);
+  s.dropped = _dropped.load(std::memory_order_relaxed);
+  s.maxDepth = _maxDepth.load(std::memory_order_relaxed);
+  s.depth = _head.load(std::memory_order_relaxed) -
+            _tail.load(std::memory_order_relaxed);
+  s.applied = _applied;
+  s.maxLatencyUs = _maxLatencyUs;
+  s.avgLatencyUs = s.applied ? (uint32_t)(_sumLatencyUs / s.applied) : 0;
+  return s;
+}
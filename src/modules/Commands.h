@@ -0,0 +1,71 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// Requests from the web handlers (async_tcp task) to the frame loop, which
+// owns the needles and the radio. Handlers push() and return at once;
+// loop() applies everything queued at the start of the next frame.
+#ifndef COMMAND_QUEUE_DEPTH
+#define COMMAND_QUEUE_DEPTH 16 // Power of two
+#endif
+
+enum class CommandType : uint8_t {
+  CalibrationMode = 0,  // arg: 1 = on (clears the needle overrides)
+  Restart = 1,          // arg: ms to wait first (lets the response go out)
+  WiFiTest = 2,         // arg: 1 = try the saved network, AP stays up;
+                        //      0 = back to the AP alone
+};
+
+struct Command {
+  CommandType type;
+  uint8_t index;
+  int64_t arg;
+  uint32_t queuedUs; // micros() at push()
+};
+
+struct CommandStats {
+  uint32_t pushed;
+  uint32_t applied;
+  uint32_t dropped; // Queue was full
+  uint32_t depth;   // Waiting now
+  uint32_t maxDepth;
+  uint32_t avgLatencyUs; // push() to apply, since boot
+  uint32_t maxLatencyUs;
+};
+
+// Bounded lock-free ring, any number of producers and one consumer. Each
+// slot carries a sequence number: producers claim a position with a CAS on
+// _head, fill the slot and then release it to the consumer, so a producer
+// that is preempted mid-push only holds up the commands behind its own.
+class CommandQueue {
+public:
+  CommandQueue();
+
+  // Any task. false (and counted as dropped) when the queue is full.
+  bool push(CommandType type, int64_t arg = 0, uint8_t index = 0);
+
+  // Frame loop only
+  bool pop(Command &out);
+  void recordApplied(const Command &cmd);
+
+  CommandStats getStats() const;
+
+private:
+  struct Slot {
+    std::atomic<uint32_t> seq;
+    Command cmd;
+  };
+
+  Slot _slots[COMMAND_QUEUE_DEPTH];
+  std::atomic<uint32_t> _head; // Next position to claim (producers)
+  std::atomic<uint32_t> _tail; // Next position to read (consumer)
+
+  std::atomic<uint32_t> _pushed;
+  std::atomic<uint32_t> _dropped;
+  std::atomic<uint32_t> _maxDepth;
+
+  // Written by the consumer only
+  volatile uint32_t _applied;
+  volatile uint32_t _maxLatencyUs;
+  volatile uint64_t _sumLatencyUs;
+};
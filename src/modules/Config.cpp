@@ -1,201 +1,566 @@
 #include "Config.h"
+#include <rom/crc.h>
 
-Config::Config() {}
+// NVS keys for the per-meter latency, indexed by CAL_METER_* (legacy layout)
+static const char *LATENCY_KEYS[3] = {"latH", "latM", "latS"};
+static const char *RETURN_KEYS[3] = {"retH", "retM", "retS"};
+
+// Section of each Config::Field, in Field order
+static const ConfigSection FIELD_SECTIONS[] = {
+    // ssid, pass
+    ConfigSection::Network, ConfigSection::Network,
+    // tz, tz2, ntp
+    ConfigSection::Time, ConfigSection::Time, ConfigSection::Time,
+    // 12h, smoothSec
+    ConfigSection::Display, ConfigSection::Display,
+    // drive, profile, latency x3, return mode, slew, budget x3
+    ConfigSection::Motion, ConfigSection::Motion, ConfigSection::Motion,
+    ConfigSection::Motion, ConfigSection::Motion, ConfigSection::Motion,
+    ConfigSection::Motion, ConfigSection::Motion, ConfigSection::Motion,
+    ConfigSection::Motion,
+    // useNTP, manualTime
+    ConfigSection::Time, ConfigSection::Time,
+    // colors, brightness, night window, count, fade
+    ConfigSection::Lighting, ConfigSection::Lighting, ConfigSection::Lighting,
+    ConfigSection::Lighting, ConfigSection::Lighting, ConfigSection::Lighting,
+    ConfigSection::Lighting, ConfigSection::Lighting, ConfigSection::Lighting,
+    ConfigSection::Lighting,
+    // calibration
+    ConfigSection::Calibration,
+    // schedule
+    ConfigSection::Lighting,
+};
+
+#define CONFIG_BLOB_KEY "cfg"
+#define CONFIG_BLOB_HEADER 8 // version, size, crc
+
+static uint32_t blobCrc(const void *blob, size_t size) {
+  return crc32_le(0, (const uint8_t *)blob + CONFIG_BLOB_HEADER,
+                  size - CONFIG_BLOB_HEADER);
+}
+
+// Blobs compare field by field: a memcmp would also compare the padding
+// (3 bytes after each LightKeyframe), which copies don't have to carry
+template <typename T> static bool sameValue(const T &a, const T &b) {
+  return a == b;
+}
+static bool sameValue(const CalibrationPoints &a, const CalibrationPoints &b) {
+  return a.version == b.version &&
+         memcmp(a.count, b.count, sizeof(a.count)) == 0 &&
+         memcmp(a.hour, b.hour, sizeof(a.hour)) == 0 &&
+         memcmp(a.minute, b.minute, sizeof(a.minute)) == 0 &&
+         memcmp(a.second, b.second, sizeof(a.second)) == 0;
+}
+static bool sameValue(const LightKeyframe &a, const LightKeyframe &b) {
+  return a.minute == b.minute && a.fadeSec == b.fadeSec &&
+         a.color == b.color && a.brightness == b.brightness;
+}
+static bool sameValue(const LightSchedulePoints &a,
+                      const LightSchedulePoints &b) {
+  if (a.version != b.version || a.count != b.count)
+    return false;
+  for (uint8_t i = 0; i < LIGHT_MAX_KEYFRAMES; i++) {
+    if (!sameValue(a.keys[i], b.keys[i]))
+      return false;
+  }
+  return true;
+}
+
+// Update the RAM cache and leave the NVS write to loop()
+template <typename T> void Config::set(Field field, T &cache, const T &value) {
+  lock();
+  _stats.saves++;
+  if (sameValue(cache, value)) {
+    _stats.unchanged++;
+  } else {
+    cache = value;
+    markDirty(field);
+  }
+  unlock();
+}
+
+// Strings longer than the field are cut short
+void Config::setString(Field field, char *cache, size_t size,
+                       const String &value) {
+  lock();
+  _stats.saves++;
+  if (strncmp(cache, value.c_str(), size - 1) == 0 &&
+      value.length() <= size - 1) {
+    _stats.unchanged++;
+  } else {
+    strlcpy(cache, value.c_str(), size);
+    markDirty(field);
+  }
+  unlock();
+}
+
+Config::Config() {
+  static_assert(sizeof(FIELD_SECTIONS) / sizeof(FIELD_SECTIONS[0]) == F_COUNT,
+                "One section per Config::Field");
+  for (uint8_t i = 0; i < (uint8_t)ConfigSection::Count; i++) {
+    _sectionGeneration[i] = 1;
+    _dispatchedGeneration[i] = 0;
+  }
+}
 
 void Config::begin() {
+  if (!_lock)
+    _lock = xSemaphoreCreateRecursiveMutex();
+  unsigned long t0 = micros();
   _prefs.begin("clock-cfg", false);
 
-  // Load into RAM cache
-  _ssid = _prefs.getString("ssid", "");
-  _pass = _prefs.getString("pass", "");
-  _tz = _prefs.getString("tz", "CST6CDT,M3.2.0,M11.1.0");
-  _tz2 = _prefs.getString("tz2", "UTC0");
-  _ntp = _prefs.getString("ntp", "pool.ntp.org");
-  _is12h = _prefs.getBool("12h", true);
-  _smoothSeconds = _prefs.getBool("smoothSec", false);
-  _useNTP = _prefs.getBool("useNTP", true);
-  _manualTime = _prefs.getULong64("manualTime", 0);
-  _dayColor = _prefs.getUInt("dayColor", 0xFFFFFF);
-  _nightColor = _prefs.getUInt("nightColor", 0xFF00FF);
-  _dayBrightness = _prefs.getUChar("dayBright", 200);
-  _nightBrightness = _prefs.getUChar("nightBright", 50);
-  _nightStart = _prefs.getUChar("nightStart", 21);
-  _nightStartMin = _prefs.getUChar("nightStartMin", 0);
-  _nightEnd = _prefs.getUChar("nightEnd", 7);
-  _nightEndMin = _prefs.getUChar("nightEndMin", 0);
-
-  // Load Calibration (Default 0-1023)
-  _calHMin = _prefs.getUShort("calHMin", 0);
-  _calHMax = _prefs.getUShort("calHMax", 1023);
-  _calMMin = _prefs.getUShort("calMMin", 0);
-  _calMMax = _prefs.getUShort("calMMax", 1023);
-  _calSMin = _prefs.getUShort("calSMin", 0);
-  _calSMin = _prefs.getUShort("calSMin", 0);
-  _calSMax = _prefs.getUShort("calSMax", 1023);
-
-  // Load Mid Calibration (Default 512 approx half)
-  _calHMid = _prefs.getUShort("calHMid", 512);
-  _calMMid = _prefs.getUShort("calMMid", 512);
-  _calSMid = _prefs.getUShort("calSMid", 512);
-}
-
-String Config::getSSID() { return _ssid; }
-String Config::getWifiPass() { return _pass; }
+  _loadedFromBlob = loadBlob();
+  if (!_loadedFromBlob)
+    loadLegacy();
+  _loadUs = micros() - t0;
+  Serial.printf("Config loaded from %s in %lu us\r\n",
+                _loadedFromBlob ? "blob" : "legacy keys",
+                (unsigned long)_loadUs);
+
+  // Migrated: store the blob now. The legacy keys are left in place, so
+  // older firmware still finds its settings after a downgrade.
+  if (!_loadedFromBlob)
+    writeBlob();
+
+  publish();
+  _published.read(_view);
+}
+
+void Config::setDefaults() {
+  memset(&_blob, 0, sizeof(_blob));
+  strlcpy(_blob.tz, "CST6CDT,M3.2.0,M11.1.0", sizeof(_blob.tz));
+  strlcpy(_blob.tz2, "UTC0", sizeof(_blob.tz2));
+  strlcpy(_blob.ntp, "pool.ntp.org", sizeof(_blob.ntp));
+  _blob.is12h = true;
+  _blob.smoothSeconds = false;
+  _blob.meterDrive = 1;
+  _blob.motionProfile = 0;
+  _blob.returnMode = 0;
+  _blob.returnSlew = 8.0f;
+  for (uint8_t m = 0; m < 3; m++)
+    _blob.returnBudgetMs[m] = 200;
+  _blob.useNTP = true;
+  _blob.dayColor = 0xFFFFFF;
+  _blob.nightColor = 0xFF00FF;
+  _blob.dayBrightness = 200;
+  _blob.nightBrightness = 50;
+  _blob.nightStart = 21;
+  _blob.nightEnd = 7;
+  _blob.ledCount = 3;
+  _blob.lightFadeSec = 30;
+
+  // Calibration: Min/Mid/Max per meter
+  const uint16_t points[3] = {0, 512, 1023};
+  _blob.cal.version = CAL_BLOB_VERSION;
+  for (uint8_t m = 0; m < 3; m++) {
+    _blob.cal.count[m] = 3;
+    memcpy(_blob.cal.points(m), points, sizeof(points));
+  }
+  _blob.schedule = dayNightSchedule();
+}
+
+// One read. A blob from older firmware (shorter, lower version) keeps the
+// defaults for the fields it doesn't have.
+bool Config::loadBlob() {
+  setDefaults();
+  size_t len = _prefs.getBytesLength(CONFIG_BLOB_KEY);
+  if (len <= CONFIG_BLOB_HEADER)
+    return false;
+
+  uint8_t *buf = (uint8_t *)malloc(len);
+  if (!buf)
+    return false;
+  ConfigBlob header;
+  bool ok = _prefs.getBytes(CONFIG_BLOB_KEY, buf, len) == len;
+  if (ok) {
+    memcpy(&header, buf, CONFIG_BLOB_HEADER);
+    ok = header.version >= 1 && header.size == len &&
+         header.crc == blobCrc(buf, len);
+  }
+  if (ok) {
+    size_t n = min(len, sizeof(_blob));
+    memcpy((uint8_t *)&_blob + CONFIG_BLOB_HEADER, buf + CONFIG_BLOB_HEADER,
+           n - CONFIG_BLOB_HEADER);
+  } else {
+    Serial.println("Config blob invalid, using the legacy keys");
+  }
+  free(buf);
+  if (!ok)
+    return false;
+
+  for (uint8_t m = 0; m < 3; m++) {
+    if (_blob.cal.count[m] < 2 ||
+        _blob.cal.count[m] > CalibrationPoints::maxPoints(m))
+      _blob.cal.count[m] = 2;
+  }
+  if (_blob.schedule.count < 1 || _blob.schedule.count > LIGHT_MAX_KEYFRAMES)
+    _blob.schedule = dayNightSchedule();
+  return true;
+}
+
+// The per-key layout of older firmware
+void Config::loadLegacy() {
+  setDefaults();
+  strlcpy(_blob.ssid, _prefs.getString("ssid", "").c_str(),
+          sizeof(_blob.ssid));
+  strlcpy(_blob.pass, _prefs.getString("pass", "").c_str(),
+          sizeof(_blob.pass));
+  strlcpy(_blob.tz, _prefs.getString("tz", _blob.tz).c_str(),
+          sizeof(_blob.tz));
+  strlcpy(_blob.tz2, _prefs.getString("tz2", _blob.tz2).c_str(),
+          sizeof(_blob.tz2));
+  strlcpy(_blob.ntp, _prefs.getString("ntp", _blob.ntp).c_str(),
+          sizeof(_blob.ntp));
+  _blob.is12h = _prefs.getBool("12h", _blob.is12h);
+  _blob.smoothSeconds = _prefs.getBool("smoothSec", _blob.smoothSeconds);
+  _blob.meterDrive = _prefs.getUChar("meterDrive", _blob.meterDrive);
+  _blob.motionProfile = _prefs.getUChar("motionProf", _blob.motionProfile);
+  for (uint8_t m = 0; m < 3; m++)
+    _blob.meterLatencyUs[m] = _prefs.getUInt(LATENCY_KEYS[m], 0);
+  _blob.returnMode = _prefs.getUChar("returnMode", _blob.returnMode);
+  _blob.returnSlew = _prefs.getFloat("returnSlew", _blob.returnSlew);
+  for (uint8_t m = 0; m < 3; m++)
+    _blob.returnBudgetMs[m] =
+        _prefs.getUShort(RETURN_KEYS[m], _blob.returnBudgetMs[m]);
+  _blob.useNTP = _prefs.getBool("useNTP", _blob.useNTP);
+  _blob.manualTime = _prefs.getULong64("manualTime", 0);
+  _blob.dayColor = _prefs.getUInt("dayColor", _blob.dayColor);
+  _blob.nightColor = _prefs.getUInt("nightColor", _blob.nightColor);
+  _blob.dayBrightness = _prefs.getUChar("dayBright", _blob.dayBrightness);
+  _blob.nightBrightness =
+      _prefs.getUChar("nightBright", _blob.nightBrightness);
+  _blob.nightStart = _prefs.getUChar("nightStart", _blob.nightStart);
+  _blob.nightStartMin = _prefs.getUChar("nightStartMin", 0);
+  _blob.nightEnd = _prefs.getUChar("nightEnd", _blob.nightEnd);
+  _blob.nightEndMin = _prefs.getUChar("nightEndMin", 0);
+  _blob.ledCount = _prefs.getUShort("ledCount", _blob.ledCount);
+  _blob.lightFadeSec = _prefs.getUShort("fadeSec", _blob.lightFadeSec);
+
+  // Calibration points blob, else the older Min/Mid/Max keys
+  CalibrationPoints cal;
+  bool calOk = _prefs.getBytesLength("calPts") == sizeof(cal) &&
+               _prefs.getBytes("calPts", &cal, sizeof(cal)) == sizeof(cal) &&
+               cal.version == CAL_BLOB_VERSION;
+  for (uint8_t m = 0; calOk && m < 3; m++) {
+    if (cal.count[m] < 2 || cal.count[m] > CalibrationPoints::maxPoints(m))
+      calOk = false;
+  }
+  if (calOk) {
+    _blob.cal = cal;
+  } else {
+    const char *keys[3][3] = {{"calHMin", "calHMid", "calHMax"},
+                              {"calMMin", "calMMid", "calMMax"},
+                              {"calSMin", "calSMid", "calSMax"}};
+    for (uint8_t m = 0; m < 3; m++) {
+      for (uint8_t i = 0; i < 3; i++) {
+        _blob.cal.points(m)[i] =
+            _prefs.getUShort(keys[m][i], _blob.cal.points(m)[i]);
+      }
+    }
+  }
+
+  // Lighting schedule blob, else the day/night settings
+  LightSchedulePoints sched;
+  if (_prefs.getBytesLength("lightSched") == sizeof(sched) &&
+      _prefs.getBytes("lightSched", &sched, sizeof(sched)) == sizeof(sched) &&
+      sched.version == LIGHT_BLOB_VERSION && sched.count >= 1 &&
+      sched.count <= LIGHT_MAX_KEYFRAMES)
+    _blob.schedule = sched;
+  else
+    _blob.schedule = dayNightSchedule();
+}
+
+void Config::writeBlob() {
+  _blob.version = CONFIG_BLOB_VERSION;
+  _blob.size = sizeof(_blob);
+  _blob.crc = blobCrc(&_blob, sizeof(_blob));
+  _prefs.putBytes(CONFIG_BLOB_KEY, &_blob, sizeof(_blob));
+}
+
+String Config::getSSID() { return _blob.ssid; }
+String Config::getWifiPass() { return _blob.pass; }
 
 void Config::saveWiFi(String ssid, String pass) {
-  _ssid = ssid;
-  _pass = pass;
-  _prefs.putString("ssid", ssid);
-  _prefs.putString("pass", pass);
+  lock();
+  setString(F_SSID, _blob.ssid, sizeof(_blob.ssid), ssid);
+  setString(F_PASS, _blob.pass, sizeof(_blob.pass), pass);
+  unlock();
 }
 
-String Config::getTimezone() { return _tz; }
+String Config::getTimezone() { return _blob.tz; }
 void Config::saveTimezone(String tz) {
-  _tz = tz;
-  _prefs.putString("tz", tz);
+  setString(F_TZ, _blob.tz, sizeof(_blob.tz), tz);
 }
 
-String Config::getNTP() { return _ntp; }
+String Config::getNTP() { return _blob.ntp; }
 void Config::saveNTP(String ntp) {
-  _ntp = ntp;
-  _prefs.putString("ntp", ntp);
+  setString(F_NTP, _blob.ntp, sizeof(_blob.ntp), ntp);
 }
 
-bool Config::get12H() { return _is12h; }
-void Config::save12H(bool is12h) {
-  _is12h = is12h;
-  _prefs.putBool("12h", is12h);
-}
+bool Config::get12H() { return _blob.is12h; }
+void Config::save12H(bool is12h) { set(F_12H, _blob.is12h, is12h); }
 
-bool Config::getSmoothSeconds() { return _smoothSeconds; }
+bool Config::getSmoothSeconds() { return _blob.smoothSeconds; }
 void Config::saveSmoothSeconds(bool smooth) {
-  _smoothSeconds = smooth;
-  _prefs.putBool("smoothSec", smooth);
+  set(F_SMOOTH_SECONDS, _blob.smoothSeconds, smooth);
 }
 
-// Time Source
-bool Config::getUseNTP() { return _useNTP; }
-void Config::saveUseNTP(bool useNTP) {
-  _useNTP = useNTP;
-  _prefs.putBool("useNTP", useNTP);
+uint8_t Config::getMeterDrive() { return _blob.meterDrive; }
+void Config::saveMeterDrive(uint8_t drive) {
+  set(F_METER_DRIVE, _blob.meterDrive, drive);
+}
+
+uint8_t Config::getMotionProfile() { return _blob.motionProfile; }
+void Config::saveMotionProfile(uint8_t profile) {
+  set(F_MOTION_PROFILE, _blob.motionProfile, profile);
 }
 
-time_t Config::getManualTime() { return _manualTime; }
+uint32_t Config::getMeterLatencyUs(uint8_t meter) {
+  return meter < 3 ? _blob.meterLatencyUs[meter] : 0;
+}
+void Config::saveMeterLatencyUs(uint8_t meter, uint32_t us) {
+  if (meter >= 3)
+    return;
+  set((Field)(F_LATENCY + meter), _blob.meterLatencyUs[meter], us);
+}
+
+uint8_t Config::getReturnMode() { return _blob.returnMode; }
+void Config::saveReturnMode(uint8_t mode) {
+  set(F_RETURN_MODE, _blob.returnMode, mode);
+}
+
+float Config::getReturnSlew() { return _blob.returnSlew; }
+void Config::saveReturnSlew(float slew) {
+  set(F_RETURN_SLEW, _blob.returnSlew, slew);
+}
+
+uint16_t Config::getReturnBudgetMs(uint8_t meter) {
+  return meter < 3 ? _blob.returnBudgetMs[meter] : 0;
+}
+void Config::saveReturnBudgetMs(uint8_t meter, uint16_t ms) {
+  if (meter >= 3)
+    return;
+  set((Field)(F_RETURN_BUDGET + meter), _blob.returnBudgetMs[meter], ms);
+}
+
+// Time Source
+bool Config::getUseNTP() { return _blob.useNTP; }
+void Config::saveUseNTP(bool useNTP) { set(F_USE_NTP, _blob.useNTP, useNTP); }
+
+time_t Config::getManualTime() { return (time_t)_blob.manualTime; }
 void Config::saveManualTime(time_t timestamp) {
-  _manualTime = timestamp;
-  _prefs.putULong64("manualTime", timestamp);
+  set(F_MANUAL_TIME, _blob.manualTime, (uint64_t)timestamp);
 }
 
 // Secondary Timezone
-String Config::getTimezone2() { return _tz2; }
+String Config::getTimezone2() { return _blob.tz2; }
 void Config::saveTimezone2(String tz) {
-  _tz2 = tz;
-  _prefs.putString("tz2", tz);
+  setString(F_TZ2, _blob.tz2, sizeof(_blob.tz2), tz);
 }
 
 // LED Day/Night Settings
-uint32_t Config::getDayColor() { return _dayColor; }
+uint32_t Config::getDayColor() { return _blob.dayColor; }
 void Config::saveDayColor(uint32_t color) {
-  _dayColor = color;
-  _prefs.putUInt("dayColor", color);
+  set(F_DAY_COLOR, _blob.dayColor, color);
 }
 
-uint32_t Config::getNightColor() {
-  // Serial.printf("Config::getNightColor returning 0x%06X\n", _nightColor);
-  return _nightColor;
-}
+uint32_t Config::getNightColor() { return _blob.nightColor; }
 void Config::saveNightColor(uint32_t color) {
-  _nightColor = color;
-  _prefs.putUInt("nightColor", color);
+  set(F_NIGHT_COLOR, _blob.nightColor, color);
 }
 
-uint8_t Config::getDayBrightness() { return _dayBrightness; }
+uint8_t Config::getDayBrightness() { return _blob.dayBrightness; }
 void Config::saveDayBrightness(uint8_t brightness) {
-  _dayBrightness = brightness;
-  _prefs.putUChar("dayBright", brightness);
+  set(F_DAY_BRIGHTNESS, _blob.dayBrightness, brightness);
 }
 
-uint8_t Config::getNightBrightness() { return _nightBrightness; }
+uint8_t Config::getNightBrightness() { return _blob.nightBrightness; }
 void Config::saveNightBrightness(uint8_t brightness) {
-  _nightBrightness = brightness;
-  _prefs.putUChar("nightBright", brightness);
+  set(F_NIGHT_BRIGHTNESS, _blob.nightBrightness, brightness);
 }
 
-uint8_t Config::getNightStart() { return _nightStart; }
+uint8_t Config::getNightStart() { return _blob.nightStart; }
 void Config::saveNightStart(uint8_t hour) {
-  _nightStart = hour;
-  _prefs.putUChar("nightStart", hour);
+  set(F_NIGHT_START, _blob.nightStart, hour);
 }
 
-uint8_t Config::getNightStartMinute() { return _nightStartMin; }
+uint8_t Config::getNightStartMinute() { return _blob.nightStartMin; }
 void Config::saveNightStartMinute(uint8_t min) {
-  _nightStartMin = min;
-  _prefs.putUChar("nightStartMin", min);
+  set(F_NIGHT_START_MIN, _blob.nightStartMin, min);
 }
 
-uint8_t Config::getNightEnd() { return _nightEnd; }
+uint8_t Config::getNightEnd() { return _blob.nightEnd; }
 void Config::saveNightEnd(uint8_t hour) {
-  _nightEnd = hour;
-  _prefs.putUChar("nightEnd", hour);
+  set(F_NIGHT_END, _blob.nightEnd, hour);
 }
 
-uint8_t Config::getNightEndMinute() { return _nightEndMin; }
+uint8_t Config::getNightEndMinute() { return _blob.nightEndMin; }
 void Config::saveNightEndMinute(uint8_t min) {
-  _nightEndMin = min;
-  _prefs.putUChar("nightEndMin", min);
+  set(F_NIGHT_END_MIN, _blob.nightEndMin, min);
+}
+
+uint16_t Config::getLedCount() { return _blob.ledCount; }
+void Config::saveLedCount(uint16_t count) {
+  set(F_LED_COUNT, _blob.ledCount, count);
+}
+
+uint16_t Config::getLightFadeSec() { return _blob.lightFadeSec; }
+void Config::saveLightFadeSec(uint16_t seconds) {
+  set(F_LIGHT_FADE_SEC, _blob.lightFadeSec, seconds);
 }
 
 // Calibration Settings
-uint16_t Config::getCalHMin() { return _calHMin; }
-void Config::saveCalHMin(uint16_t val) {
-  _calHMin = val;
-  _prefs.putUShort("calHMin", val);
+const CalibrationPoints &Config::getCalibration() { return _blob.cal; }
+
+uint8_t Config::getCalCount(uint8_t meter) { return _blob.cal.count[meter]; }
+
+const uint16_t *Config::getCalPoints(uint8_t meter) {
+  return _blob.cal.points(meter);
+}
+
+void Config::saveCalibration(const CalibrationPoints &cal) {
+  CalibrationPoints c = cal;
+  c.version = CAL_BLOB_VERSION;
+  set(F_CALIBRATION, _blob.cal, c);
+}
+
+// Lighting Schedule
+LightSchedulePoints Config::dayNightSchedule() {
+  LightSchedulePoints s;
+  memset(&s, 0, sizeof(s));
+  s.version = LIGHT_BLOB_VERSION;
+  s.count = 2;
+  s.keys[0].minute = _blob.nightEnd * 60 + _blob.nightEndMin;
+  s.keys[0].fadeSec = _blob.lightFadeSec;
+  s.keys[0].color = _blob.dayColor;
+  s.keys[0].brightness = _blob.dayBrightness;
+  s.keys[1].minute = _blob.nightStart * 60 + _blob.nightStartMin;
+  s.keys[1].fadeSec = _blob.lightFadeSec;
+  s.keys[1].color = _blob.nightColor;
+  s.keys[1].brightness = _blob.nightBrightness;
+  if (s.keys[1].minute == s.keys[0].minute)
+    s.count = 1; // No night at all
+  return s;
+}
+
+const LightSchedulePoints &Config::getLightSchedule() {
+  return _blob.schedule;
+}
+
+void Config::saveLightSchedule(const LightSchedulePoints &schedule) {
+  LightSchedulePoints s = schedule;
+  s.version = LIGHT_BLOB_VERSION;
+  set(F_LIGHT_SCHEDULE, _blob.schedule, s);
 }
 
-uint16_t Config::getCalHMax() { return _calHMax; }
-void Config::saveCalHMax(uint16_t val) {
-  _calHMax = val;
-  _prefs.putUShort("calHMax", val);
+// Locking
+void Config::lock() {
+  xSemaphoreTakeRecursive(_lock, portMAX_DELAY);
+  _lockDepth++;
 }
 
-uint16_t Config::getCalHMid() { return _calHMid; }
-void Config::saveCalHMid(uint16_t val) {
-  _calHMid = val;
-  _prefs.putUShort("calHMid", val);
+bool Config::tryLock() {
+  if (xSemaphoreTakeRecursive(_lock, 0) != pdTRUE)
+    return false;
+  _lockDepth++;
+  return true;
 }
 
-uint16_t Config::getCalMMin() { return _calMMin; }
-void Config::saveCalMMin(uint16_t val) {
-  _calMMin = val;
-  _prefs.putUShort("calMMin", val);
+void Config::unlock() {
+  if (--_lockDepth == 0 && _generation != _publishedGeneration)
+    publish();
+  xSemaphoreGiveRecursive(_lock);
 }
 
-uint16_t Config::getCalMMax() { return _calMMax; }
-void Config::saveCalMMax(uint16_t val) {
-  _calMMax = val;
-  _prefs.putUShort("calMMax", val);
+// Called with the lock held (or before the tasks start)
+void Config::publish() {
+  _staging.generation = _generation;
+  for (uint8_t i = 0; i < (uint8_t)ConfigSection::Count; i++)
+    _staging.sectionGeneration[i] = _sectionGeneration[i];
+  _staging.settings = _blob;
+  _published.publish(_staging);
+  _publishedGeneration = _generation;
 }
 
-uint16_t Config::getCalMMid() { return _calMMid; }
-void Config::saveCalMMid(uint16_t val) {
-  _calMMid = val;
-  _prefs.putUShort("calMMid", val);
+// Write Behind
+Config::Transaction::Transaction(Config &config) : _config(config) {
+  _config.lock();
+  _startGeneration = _config._generation;
 }
 
-uint16_t Config::getCalSMin() { return _calSMin; }
-void Config::saveCalSMin(uint16_t val) {
-  _calSMin = val;
-  _prefs.putUShort("calSMin", val);
+Config::Transaction::~Transaction() { _config.unlock(); }
+
+void Config::markDirty(Field field) {
+  uint32_t bit = 1UL << field;
+  unsigned long now = millis();
+  _stats.writes++;
+  if (_dirty & bit)
+    _stats.coalesced++;
+  if (!_dirty)
+    _firstChangeMs = now;
+  _dirty |= bit;
+  _lastChangeMs = now;
+  _sectionGeneration[(uint8_t)FIELD_SECTIONS[field]]++;
+  _generation++;
+}
+
+// Change Notifications
+bool Config::onChange(uint32_t sections, ConfigListener listener) {
+  if (_listenerCount >= CONFIG_MAX_LISTENERS)
+    return false;
+  _listeners[_listenerCount].sections = sections;
+  _listeners[_listenerCount].fn = listener;
+  _listenerCount++;
+  return true;
+}
+
+void Config::dispatch() {
+  // A new snapshot always comes with a new generation
+  if (_generation != _view.generation)
+    _published.read(_view);
+
+  uint32_t changed = 0;
+  for (uint8_t i = 0; i < (uint8_t)ConfigSection::Count; i++) {
+    uint32_t gen = _view.sectionGeneration[i];
+    if (gen != _dispatchedGeneration[i]) {
+      _dispatchedGeneration[i] = gen;
+      changed |= 1UL << i;
+    }
+  }
+  if (!changed)
+    return;
+  for (uint8_t i = 0; i < _listenerCount; i++) {
+    if (_listeners[i].sections & changed)
+      _listeners[i].fn(changed);
+  }
+}
+
+void Config::loop() {
+  if (!_dirty)
+    return;
+  unsigned long now = millis();
+  if (now - _lastChangeMs < CONFIG_FLUSH_DELAY_MS &&
+      now - _firstChangeMs < CONFIG_FLUSH_MAX_MS)
+    return;
+
+  // Never wait on an open transaction; try again next time round
+  if (!tryLock())
+    return;
+  writeDirty();
+  unlock();
 }
 
-uint16_t Config::getCalSMax() { return _calSMax; }
-void Config::saveCalSMax(uint16_t val) {
-  _calSMax = val;
-  _prefs.putUShort("calSMax", val);
+void Config::flush() {
+  lock();
+  writeDirty();
+  unlock();
 }
 
-uint16_t Config::getCalSMid() { return _calSMid; }
-void Config::saveCalSMid(uint16_t val) {
-  _calSMid = val;
-  _prefs.putUShort("calSMid", val);
+// However many settings changed, it is one blob write
+void Config::writeDirty() {
+  if (!_dirty)
+    return;
+  writeBlob();
+  _dirty = 0;
+  _stats.flushes++;
 }
@@ -1,12 +1,183 @@
 #pragma once
 #include <Arduino.h>
+#include "Snapshot.h"
 #include <Preferences.h>
 
+// Meter calibration points, evenly spaced over each scale.
+// Hour: up to 13 points (every hour in 12H, every 2 hours in 24H).
+// Minute/Second: up to 61 points (one per minute/second mark).
+#define CAL_METER_H 0
+#define CAL_METER_M 1
+#define CAL_METER_S 2
+#define CAL_MAX_POINTS_H 13
+#define CAL_MAX_POINTS_MS 61
+#define CAL_BLOB_VERSION 1
+
+struct CalibrationPoints {
+  uint8_t version;
+  uint8_t count[3]; // Active points per meter (>= 2)
+  uint16_t hour[CAL_MAX_POINTS_H];
+  uint16_t minute[CAL_MAX_POINTS_MS];
+  uint16_t second[CAL_MAX_POINTS_MS];
+
+  uint16_t *points(uint8_t meter) {
+    return meter == CAL_METER_H ? hour
+                                : (meter == CAL_METER_M ? minute : second);
+  }
+  const uint16_t *points(uint8_t meter) const {
+    return const_cast<CalibrationPoints *>(this)->points(meter);
+  }
+  static uint8_t maxPoints(uint8_t meter) {
+    return meter == CAL_METER_H ? CAL_MAX_POINTS_H : CAL_MAX_POINTS_MS;
+  }
+};
+
+// Lighting schedule: up to 16 time-of-day keyframes. From each keyframe's
+// minute the lights fade to its colour/brightness over fadeSec and hold
+// until the next one (the last wraps round to the first).
+#define LIGHT_MAX_KEYFRAMES 16
+#define LIGHT_BLOB_VERSION 1
+
+struct LightKeyframe {
+  uint16_t minute;  // Minute of the day, 0-1439
+  uint16_t fadeSec; // Transition into this look, 0 = switch
+  uint32_t color;   // 0xRRGGBB
+  uint8_t brightness;
+};
+
+struct LightSchedulePoints {
+  uint8_t version;
+  uint8_t count; // Active keyframes (>= 1)
+  LightKeyframe keys[LIGHT_MAX_KEYFRAMES];
+};
+
+// All settings, stored as one NVS blob ("cfg"). Fields are only ever
+// appended, so a shorter blob from older firmware loads over the defaults.
+#define CONFIG_BLOB_VERSION 1
+
+struct ConfigBlob {
+  uint16_t version;
+  uint16_t size; // sizeof(ConfigBlob) when written
+  uint32_t crc;  // CRC32 of the rest of the blob
+
+  char ssid[33];
+  char pass[65];
+  char tz[64];
+  char tz2[64];
+  char ntp[64];
+  bool is12h;
+  bool smoothSeconds;
+  uint8_t meterDrive;
+  uint8_t motionProfile;
+  uint32_t meterLatencyUs[3];
+  uint8_t returnMode;
+  float returnSlew;
+  uint16_t returnBudgetMs[3];
+  bool useNTP;
+  uint64_t manualTime;
+  uint32_t dayColor;
+  uint32_t nightColor;
+  uint8_t dayBrightness;
+  uint8_t nightBrightness;
+  uint8_t nightStart;
+  uint8_t nightStartMin;
+  uint8_t nightEnd;
+  uint8_t nightEndMin;
+  uint16_t ledCount;
+  uint16_t lightFadeSec;
+  CalibrationPoints cal;
+  LightSchedulePoints schedule;
+};
+
+// save*() updates the RAM cache at once; the NVS writes are made later by
+// loop() from the housekeeping task, CONFIG_FLUSH_DELAY_MS after the last
+// change (or CONFIG_FLUSH_MAX_MS after the first, if edits keep coming)
+#define CONFIG_FLUSH_DELAY_MS 1000
+#define CONFIG_FLUSH_MAX_MS 10000
+
+struct ConfigWriteStats {
+  uint32_t saves;     // save*() calls
+  uint32_t unchanged; // Value already stored or pending, nothing to write
+  uint32_t coalesced; // Replaced a write that was still pending
+  uint32_t writes;    // Changed values, each queued for the next flush
+  uint32_t flushes;   // Blob writes made
+};
+
+// Settings grouped by what has to be rebuilt when they change
+enum class ConfigSection : uint8_t {
+  Network = 0,     // WiFi credentials
+  Time = 1,        // Timezones, NTP server, time source
+  Display = 2,     // Hour scale, sweeping seconds
+  Motion = 3,      // Needle drive, profile, latency, returns
+  Lighting = 4,    // LED count, day/night looks, schedule
+  Calibration = 5, // Meter calibration points
+  Count = 6,
+};
+#define CONFIG_SECTION(s) (1UL << (uint8_t)ConfigSection::s)
+#define CONFIG_SECTION_ALL ((1UL << (uint8_t)ConfigSection::Count) - 1)
+#define CONFIG_MAX_LISTENERS 8
+
+// Settings as published to the frame loop, with the generations they are
+// from
+struct ConfigView {
+  uint32_t generation;
+  uint32_t sectionGeneration[(uint8_t)ConfigSection::Count];
+  ConfigBlob settings;
+};
+
+// Called with the CONFIG_SECTION() bits that changed
+typedef void (*ConfigListener)(uint32_t changed);
+
 class Config {
 public:
   Config();
   void begin();
 
+  // Groups saves so loop() never writes half of them:
+  //   Config::Transaction tx(_config);
+  //   _config.saveNightStart(h);
+  //   _config.saveNightStartMinute(m);
+  // Writes are still deferred unless commit() is called.
+  class Transaction {
+  public:
+    explicit Transaction(Config &config);
+    ~Transaction();
+    bool changed() const { return _config._generation != _startGeneration; }
+    void commit() { _config.flush(); } // Write everything pending now
+
+  private:
+    Config &_config;
+    uint32_t _startGeneration;
+  };
+
+  void loop();  // Write behind: flush once the edits have settled
+  void flush(); // Write everything pending now (e.g. before a restart)
+  ConfigWriteStats getWriteStats() const { return _stats; }
+
+  // Bumped by every change to a setting, overall and per section. Both
+  // start at 1, so the first dispatch() runs every listener.
+  uint32_t getGeneration() const { return _generation; }
+  uint32_t getGeneration(ConfigSection section) const {
+    return _sectionGeneration[(uint8_t)section];
+  }
+
+  // Derived state (tables, applied modes) is rebuilt by listeners, which
+  // dispatch() calls for the sections changed since it last ran. Call it
+  // from the task that owns that state, not from the web handlers.
+  bool onChange(uint32_t sections, ConfigListener listener);
+  void dispatch();
+
+  // Frame loop only: the settings as of its last dispatch(). The getters
+  // above read the live copy the web handlers write; this one is a
+  // lock-free snapshot, published whole when the outermost save or
+  // transaction ends, so it never has half of an update or a string
+  // being rewritten.
+  const ConfigBlob &view() const { return _view.settings; }
+
+  // How begin() loaded the settings, and how long it took
+  bool loadedFromBlob() const { return _loadedFromBlob; }
+  uint32_t getLoadUs() const { return _loadUs; }
+
   // WiFi
   String getSSID();
   String getWifiPass();
@@ -25,6 +196,24 @@ public:
   bool getSmoothSeconds();
   void saveSmoothSeconds(bool smooth);
 
+  uint8_t getMeterDrive(); // 0 = Software ramp, 1 = LEDC hardware fade
+  void saveMeterDrive(uint8_t drive);
+
+  uint8_t getMotionProfile(); // See MotionProfile in Meter.h
+  void saveMotionProfile(uint8_t profile);
+
+  // Needle latency per meter (CAL_METER_*), 0 = measure automatically
+  uint32_t getMeterLatencyUs(uint8_t meter);
+  void saveMeterLatencyUs(uint8_t meter, uint32_t us);
+
+  // Scale wrap (59->0, 23->0) return, see ReturnMode in Meter.h
+  uint8_t getReturnMode();
+  void saveReturnMode(uint8_t mode);
+  float getReturnSlew(); // Max return speed, PWM units per ms
+  void saveReturnSlew(float slew);
+  uint16_t getReturnBudgetMs(uint8_t meter); // Per meter (CAL_METER_*)
+  void saveReturnBudgetMs(uint8_t meter, uint16_t ms);
+
   // Time Source
   bool getUseNTP(); // true = NTP, false = Manual
   void saveUseNTP(bool useNTP);
@@ -59,61 +248,100 @@ public:
   uint8_t getNightEndMinute();
   void saveNightEndMinute(uint8_t min);
 
-  // Calibration Settings
-  uint16_t getCalHMin();
-  void saveCalHMin(uint16_t val);
-  uint16_t getCalHMax();
-  void saveCalHMax(uint16_t val);
-
-  uint16_t getCalHMid();
-  void saveCalHMid(uint16_t val);
-
-  uint16_t getCalMMin();
-  void saveCalMMin(uint16_t val);
-  uint16_t getCalMMax();
-  void saveCalMMax(uint16_t val);
+  uint16_t getLedCount(); // Pixels on the strip, 1-LED_MAX_COUNT
+  void saveLedCount(uint16_t count);
 
-  uint16_t getCalMMid();
-  void saveCalMMid(uint16_t val);
+  uint16_t getLightFadeSec(); // Day/night crossfade, 0 = switch
+  void saveLightFadeSec(uint16_t seconds);
 
-  uint16_t getCalSMin();
-  void saveCalSMin(uint16_t val);
-  uint16_t getCalSMax();
-  void saveCalSMax(uint16_t val);
+  // Lighting schedule (stored as one NVS blob). Until one is saved it is
+  // the day/night pair above.
+  const LightSchedulePoints &getLightSchedule();
+  void saveLightSchedule(const LightSchedulePoints &schedule);
+  LightSchedulePoints dayNightSchedule();
 
-  uint16_t getCalSMid();
-  void saveCalSMid(uint16_t val);
+  // Calibration Settings (stored as one NVS blob)
+  const CalibrationPoints &getCalibration();
+  uint8_t getCalCount(uint8_t meter);
+  const uint16_t *getCalPoints(uint8_t meter);
+  void saveCalibration(const CalibrationPoints &cal);
 
 private:
   Preferences _prefs;
 
-  // RAM Cache
-  String _ssid;
-  String _pass;
-  String _tz;
-  String _tz2;
-  String _ntp;
-  bool _is12h;
-  bool _smoothSeconds;
-  bool _useNTP;
-  time_t _manualTime;
-  uint32_t _dayColor;
-  uint32_t _nightColor;
-  uint8_t _dayBrightness;
-  uint8_t _nightBrightness;
-  uint8_t _nightStart;
-  uint8_t _nightStartMin;
-  uint8_t _nightEnd;
-  uint8_t _nightEndMin;
-
-  // Calibration Cache
-  uint16_t _calHMin;
-  uint16_t _calHMax;
-  uint16_t _calMMin;
-  uint16_t _calMMax;
-  uint16_t _calSMin;
-  uint16_t _calSMax;
-  uint16_t _calHMid;
-  uint16_t _calMMid;
-  uint16_t _calSMid;
+  // One dirty bit per setting (for the write stats, the blob is written
+  // whole)
+  enum Field : uint8_t {
+    F_SSID,
+    F_PASS,
+    F_TZ,
+    F_TZ2,
+    F_NTP,
+    F_12H,
+    F_SMOOTH_SECONDS,
+    F_METER_DRIVE,
+    F_MOTION_PROFILE,
+    F_LATENCY, // + meter
+    F_RETURN_MODE = F_LATENCY + 3,
+    F_RETURN_SLEW,
+    F_RETURN_BUDGET, // + meter
+    F_USE_NTP = F_RETURN_BUDGET + 3,
+    F_MANUAL_TIME,
+    F_DAY_COLOR,
+    F_NIGHT_COLOR,
+    F_DAY_BRIGHTNESS,
+    F_NIGHT_BRIGHTNESS,
+    F_NIGHT_START,
+    F_NIGHT_START_MIN,
+    F_NIGHT_END,
+    F_NIGHT_END_MIN,
+    F_LED_COUNT,
+    F_LIGHT_FADE_SEC,
+    F_CALIBRATION,
+    F_LIGHT_SCHEDULE,
+    F_COUNT,
+  };
+
+  // Held by save*(), transactions and flushes (recursive)
+  SemaphoreHandle_t _lock = nullptr;
+  uint8_t _lockDepth = 0;
+  void lock();
+  bool tryLock();
+  void unlock(); // Publishes on the way out of the outermost lock
+
+  volatile uint32_t _dirty = 0; // 1 << Field
+  volatile uint32_t _generation = 1;
+  volatile uint32_t _sectionGeneration[(uint8_t)ConfigSection::Count];
+  uint32_t _dispatchedGeneration[(uint8_t)ConfigSection::Count];
+
+  Snapshot<ConfigView> _published;
+  ConfigView _staging; // Built under the lock
+  ConfigView _view;    // Frame loop's copy
+  uint32_t _publishedGeneration = 0;
+  void publish();
+
+  struct Listener {
+    uint32_t sections;
+    ConfigListener fn;
+  };
+  Listener _listeners[CONFIG_MAX_LISTENERS];
+  uint8_t _listenerCount = 0;
+  unsigned long _firstChangeMs = 0;
+  unsigned long _lastChangeMs = 0;
+  ConfigWriteStats _stats = {};
+
+  template <typename T> void set(Field field, T &cache, const T &value);
+  void markDirty(Field field);
+  void writeDirty();
+
+  // RAM cache, written back whole
+  ConfigBlob _blob;
+  bool _loadedFromBlob = false;
+  uint32_t _loadUs = 0;
+
+  void setDefaults();
+  bool loadBlob();
+  void loadLegacy();
+  void writeBlob();
+  void setString(Field field, char *cache, size_t size, const String &value);
 };
@@ -0,0 +1,495 @@
+#include "ConfigJson.h"
+#include "LedOutput.h"
+#include "LightSchedule.h"
+#include "Meter.h"
+
+extern Meter meterH;
+extern Meter meterM;
+extern Meter meterS;
+
+static const char *const SECTION_NAMES[] = {
+    "network", "time", "display", "motion", "lighting", "calibration",
+};
+static_assert(sizeof(SECTION_NAMES) / sizeof(SECTION_NAMES[0]) ==
+                  (size_t)ConfigSection::Count,
+              "One name per ConfigSection");
+
+// Limits the forms use too
+#define JSON_MAX_LATENCY_US 1000000
+#define JSON_MAX_RETURN_MS 2000
+#define JSON_MAX_FADE_SEC 3600
+#define JSON_MAX_CAL_VALUE 1023
+
+#define JSON_STR_(x) #x
+#define JSON_STR(x) JSON_STR_(x)
+
+const char *configSectionName(ConfigSection section) {
+  return SECTION_NAMES[(uint8_t)section];
+}
+
+static bool sectionFromName(const char *name, ConfigSection &section) {
+  for (uint8_t i = 0; i < (uint8_t)ConfigSection::Count; i++) {
+    if (strcmp(name, SECTION_NAMES[i]) == 0) {
+      section = (ConfigSection)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool isInt(JsonVariantConst v, long lo, long hi) {
+  return v.is<long>() && v.as<long>() >= lo && v.as<long>() <= hi;
+}
+
+// Shorter than `size` with its terminator, as the Config fields are
+static bool isString(JsonVariantConst v, size_t size) {
+  return v.is<const char *>() && strlen(v.as<const char *>()) < size;
+}
+
+static bool isColor(JsonVariantConst v) {
+  if (!isString(v, 8))
+    return false;
+  const char *c = v.as<const char *>();
+  if (c[0] != '#' || strlen(c) != 7)
+    return false;
+  for (uint8_t i = 1; i < 7; i++) {
+    if (!isxdigit((unsigned char)c[i]))
+      return false;
+  }
+  return true;
+}
+
+// Exactly three integers, one per meter (CAL_METER_*)
+static bool isMeterInts(JsonVariantConst v, long lo, long hi) {
+  if (!v.is<JsonArrayConst>() || v.size() != 3)
+    return false;
+  for (JsonVariantConst x : v.as<JsonArrayConst>()) {
+    if (!isInt(x, lo, hi))
+      return false;
+  }
+  return true;
+}
+
+// [{"t":"HH:MM","c":"#rrggbb","b":0-255,"f":fade seconds}, ...], as
+// /api/led/schedule. Sorted by time on the way in.
+static const char *parseSchedule(JsonVariantConst v, LightSchedulePoints &s) {
+  if (!v.is<JsonArrayConst>() || v.size() < 1 ||
+      v.size() > LIGHT_MAX_KEYFRAMES)
+    return "expected 1-" JSON_STR(LIGHT_MAX_KEYFRAMES) " keyframes";
+  memset(&s, 0, sizeof(s));
+  s.version = LIGHT_BLOB_VERSION;
+  for (JsonVariantConst k : v.as<JsonArrayConst>()) {
+    unsigned h, m;
+    char extra;
+    if (!isString(k["t"], 6) ||
+        sscanf(k["t"].as<const char *>(), "%u:%u%c", &h, &m, &extra) != 2 ||
+        h > 23 || m > 59)
+      return "keyframe t: expected \"HH:MM\"";
+    if (!isColor(k["c"]))
+      return "keyframe c: expected \"#rrggbb\"";
+    if (!isInt(k["b"], 0, 255))
+      return "keyframe b: expected 0-255";
+    if (!isInt(k["f"], 0, JSON_MAX_FADE_SEC))
+      return "keyframe f: expected 0-3600 seconds";
+
+    uint16_t minute = h * 60 + m;
+    for (uint8_t j = 0; j < s.count; j++) {
+      if (s.keys[j].minute == minute)
+        return "keyframe t: duplicate time";
+    }
+    LightKeyframe &key = s.keys[s.count++];
+    key.minute = minute;
+    key.color = strtoul(k["c"].as<const char *>() + 1, NULL, 16);
+    key.brightness = k["b"].as<uint8_t>();
+    key.fadeSec = k["f"].as<uint16_t>();
+  }
+
+  ScheduleTable sorted;
+  sorted.build(s);
+  for (uint8_t i = 0; i < s.count; i++)
+    s.keys[i] = sorted.key(i);
+  return nullptr;
+}
+
+static void writeLimits(JsonObject out, const char *key) {
+  JsonObject limits = out.createNestedObject(key);
+  limits["ledCount"] = LED_MAX_COUNT;
+  limits["keyframes"] = LIGHT_MAX_KEYFRAMES;
+}
+
+static void writeMeasuredLatency(JsonObject out, const char *key) {
+  JsonArray measured = out.createNestedArray(key);
+  Meter *meters[] = {&meterH, &meterM, &meterS};
+  for (uint8_t i = 0; i < 3; i++)
+    measured.add(meters[i]->getMeasuredLatencyUs());
+}
+
+// Software while a non-linear profile is set, whatever meterDrive says
+static void writeActiveDrive(JsonObject out, const char *key) {
+  out[key] = (uint8_t)meterH.getDrive();
+}
+
+// State shown next to the settings, not settings. GET writes these keys
+// and PATCH passes over them, so a document read, edited and sent back
+// whole is accepted.
+struct ReadOnlyKey {
+  int8_t section; // ConfigSection, or -1 at the top level
+  const char *key;
+  void (*write)(JsonObject out, const char *key);
+};
+static const ReadOnlyKey READ_ONLY_KEYS[] = {
+    {-1, "limits", writeLimits},
+    {(int8_t)ConfigSection::Motion, "measuredLatencyUs", writeMeasuredLatency},
+    {(int8_t)ConfigSection::Motion, "activeDrive", writeActiveDrive},
+};
+
+static void writeReadOnly(JsonObject out, int8_t section) {
+  for (const ReadOnlyKey &r : READ_ONLY_KEYS) {
+    if (r.section == section)
+      r.write(out, r.key);
+  }
+}
+
+static bool isReadOnly(int8_t section, const char *key) {
+  for (const ReadOnlyKey &r : READ_ONLY_KEYS) {
+    if (r.section == section && strcmp(r.key, key) == 0)
+      return true;
+  }
+  return false;
+}
+
+ConfigJson::ConfigJson(Config &config) : _config(config), _changed(false) {}
+
+void ConfigJson::write(JsonObject out, uint32_t sections) {
+  out["generation"] = _config.getGeneration();
+  for (uint8_t i = 0; i < (uint8_t)ConfigSection::Count; i++) {
+    if (sections & (1UL << i))
+      writeSection(out.createNestedObject(SECTION_NAMES[i]), (ConfigSection)i);
+  }
+  writeReadOnly(out, -1);
+}
+
+void ConfigJson::writeSection(JsonObject out, ConfigSection section) {
+  writeSettings(out, section);
+  writeReadOnly(out, (int8_t)section);
+}
+
+void ConfigJson::writeSettings(JsonObject out, ConfigSection section) {
+  switch (section) {
+  case ConfigSection::Network:
+    out["ssid"] = _config.getSSID(); // The password is never sent
+    break;
+
+  case ConfigSection::Time:
+    out["timezone"] = _config.getTimezone();
+    out["timezone2"] = _config.getTimezone2();
+    out["ntp"] = _config.getNTP();
+    out["useNTP"] = _config.getUseNTP();
+    out["manualTime"] = (int64_t)_config.getManualTime();
+    break;
+
+  case ConfigSection::Display:
+    out["h12"] = _config.get12H();
+    out["smoothSeconds"] = _config.getSmoothSeconds();
+    break;
+
+  case ConfigSection::Motion: {
+    out["meterDrive"] = _config.getMeterDrive();
+    out["motionProfile"] = _config.getMotionProfile();
+    out["returnMode"] = _config.getReturnMode();
+    out["returnSlew"] = _config.getReturnSlew();
+    JsonArray latency = out.createNestedArray("latencyUs");
+    JsonArray budget = out.createNestedArray("returnBudgetMs");
+    for (uint8_t i = 0; i < 3; i++) {
+      latency.add(_config.getMeterLatencyUs(i));
+      budget.add(_config.getReturnBudgetMs(i));
+    }
+    break;
+  }
+
+  case ConfigSection::Lighting: {
+    out["ledCount"] = _config.getLedCount();
+    const LightSchedulePoints &s = _config.getLightSchedule();
+    JsonArray keys = out.createNestedArray("schedule");
+    for (uint8_t i = 0; i < s.count; i++) {
+      const LightKeyframe &k = s.keys[i];
+      char t[12], c[8]; // t fits any uint16_t minute, not just 0-1439
+      snprintf(t, sizeof(t), "%02u:%02u", k.minute / 60, k.minute % 60);
+      snprintf(c, sizeof(c), "#%06x", (unsigned)(k.color & 0xFFFFFF));
+      JsonObject key = keys.createNestedObject();
+      key["t"] = t; // Copied (char *)
+      key["c"] = c;
+      key["b"] = k.brightness;
+      key["f"] = k.fadeSec;
+    }
+    break;
+  }
+
+  case ConfigSection::Calibration: {
+    const char *names[] = {"h", "m", "s"};
+    for (uint8_t m = 0; m < 3; m++) {
+      JsonArray pts = out.createNestedArray(names[m]);
+      const uint16_t *p = _config.getCalPoints(m);
+      for (uint8_t i = 0; i < _config.getCalCount(m); i++)
+        pts.add(p[i]);
+    }
+    break;
+  }
+
+  default:
+    break;
+  }
+}
+
+int ConfigJson::patch(JsonObjectConst doc) {
+  if (doc.isNull()) {
+    _error = "expected an object";
+    return 400;
+  }
+  Config::Transaction tx(_config);
+
+  JsonVariantConst generation = doc["generation"];
+  if (!generation.isNull() &&
+      (!generation.is<uint32_t>() ||
+       generation.as<uint32_t>() != _config.getGeneration())) {
+    _error = "generation: the settings changed since it was read";
+    return 409;
+  }
+
+  // Check everything, then save everything
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    for (JsonPairConst kv : doc) {
+      const char *key = kv.key().c_str();
+      ConfigSection section;
+      if (strcmp(key, "generation") == 0 || isReadOnly(-1, key))
+        continue;
+      if (!sectionFromName(key, section)) {
+        _error = String(key) + ": unknown section";
+        return 400;
+      }
+      if (!(CONFIG_JSON_WRITABLE & (1UL << (uint8_t)section))) {
+        if (pass == 0 && !matches(section, kv.value()))
+          return 405; // Nothing saved yet
+        continue;
+      }
+      if (!apply(section, kv.value(), pass == 1))
+        return 400;
+    }
+  }
+  _changed = tx.changed();
+  return 200;
+}
+
+int ConfigJson::patchSection(ConfigSection section, JsonObjectConst values) {
+  if (!(CONFIG_JSON_WRITABLE & (1UL << (uint8_t)section)))
+    return matches(section, values) ? 200 : 405;
+  Config::Transaction tx(_config);
+  if (!apply(section, values, false))
+    return 400;
+  apply(section, values, true);
+  _changed = tx.changed();
+  return 200;
+}
+
+// A read-only section may be sent back as it was read: each value given
+// has to be the one GET shows
+bool ConfigJson::matches(ConfigSection section, JsonVariantConst values) {
+  DynamicJsonDocument current(CONFIG_JSON_SIZE);
+  writeSection(current.to<JsonObject>(), section);
+  if (values.is<JsonObjectConst>()) {
+    for (JsonPairConst kv : values.as<JsonObjectConst>()) {
+      if (current[kv.key()] != kv.value()) {
+        fail(section, kv.key().c_str(), "read-only");
+        return false;
+      }
+    }
+    return true;
+  }
+  fail(section, nullptr, "read-only");
+  return false;
+}
+
+bool ConfigJson::apply(ConfigSection section, JsonObjectConst values,
+                       bool save) {
+  if (values.isNull())
+    return fail(section, nullptr, "expected an object");
+  switch (section) {
+  case ConfigSection::Time:
+    return applyTime(values, save);
+  case ConfigSection::Display:
+    return applyDisplay(values, save);
+  case ConfigSection::Motion:
+    return applyMotion(values, save);
+  case ConfigSection::Lighting:
+    return applyLighting(values, save);
+  case ConfigSection::Calibration:
+    return applyCalibration(values, save);
+  default:
+    return true;
+  }
+}
+
+bool ConfigJson::applyTime(JsonObjectConst values, bool save) {
+  for (JsonPairConst kv : values) {
+    const char *key = kv.key().c_str();
+    JsonVariantConst v = kv.value();
+    if (strcmp(key, "timezone") == 0 || strcmp(key, "timezone2") == 0) {
+      if (!isString(v, sizeof(ConfigBlob::tz)) || !*v.as<const char *>())
+        return fail(ConfigSection::Time, key, "expected a POSIX TZ string");
+      if (save && key[8] == '2')
+        _config.saveTimezone2(v.as<const char *>());
+      else if (save)
+        _config.saveTimezone(v.as<const char *>());
+    } else if (strcmp(key, "ntp") == 0) {
+      if (!isString(v, sizeof(ConfigBlob::ntp)))
+        return fail(ConfigSection::Time, key, "expected a host name");
+      if (save)
+        _config.saveNTP(v.as<const char *>());
+    } else if (strcmp(key, "useNTP") == 0) {
+      if (!v.is<bool>())
+        return fail(ConfigSection::Time, key, "expected true or false");
+      if (save)
+        _config.saveUseNTP(v.as<bool>());
+    } else if (strcmp(key, "manualTime") == 0) {
+      if (!v.is<int64_t>() || v.as<int64_t>() < 0)
+        return fail(ConfigSection::Time, key, "expected a Unix timestamp");
+      if (save)
+        _config.saveManualTime((time_t)v.as<int64_t>());
+    } else if (!isReadOnly((int8_t)ConfigSection::Time, key)) {
+      return fail(ConfigSection::Time, key, "unknown setting");
+    }
+  }
+  return true;
+}
+
+bool ConfigJson::applyDisplay(JsonObjectConst values, bool save) {
+  for (JsonPairConst kv : values) {
+    const char *key = kv.key().c_str();
+    JsonVariantConst v = kv.value();
+    bool h12 = strcmp(key, "h12") == 0;
+    if (isReadOnly((int8_t)ConfigSection::Display, key))
+      continue;
+    if (!h12 && strcmp(key, "smoothSeconds") != 0)
+      return fail(ConfigSection::Display, key, "unknown setting");
+    if (!v.is<bool>())
+      return fail(ConfigSection::Display, key, "expected true or false");
+    if (save && h12)
+      _config.save12H(v.as<bool>());
+    else if (save)
+      _config.saveSmoothSeconds(v.as<bool>());
+  }
+  return true;
+}
+
+bool ConfigJson::applyMotion(JsonObjectConst values, bool save) {
+  for (JsonPairConst kv : values) {
+    const char *key = kv.key().c_str();
+    JsonVariantConst v = kv.value();
+    if (strcmp(key, "meterDrive") == 0) {
+      if (!isInt(v, 0, 1))
+        return fail(ConfigSection::Motion, key, "expected 0 or 1");
+      if (save)
+        _config.saveMeterDrive(v.as<uint8_t>());
+    } else if (strcmp(key, "motionProfile") == 0) {
+      if (!isInt(v, 0, 3))
+        return fail(ConfigSection::Motion, key, "expected 0-3");
+      if (save)
+        _config.saveMotionProfile(v.as<uint8_t>());
+    } else if (strcmp(key, "returnMode") == 0) {
+      if (!isInt(v, 0, 2))
+        return fail(ConfigSection::Motion, key, "expected 0-2");
+      if (save)
+        _config.saveReturnMode(v.as<uint8_t>());
+    } else if (strcmp(key, "returnSlew") == 0) {
+      if (!v.is<float>() || v.as<float>() < METER_SLEW_PER_MS ||
+          v.as<float>() > 100.0f)
+        return fail(ConfigSection::Motion, key, "expected 1.8-100");
+      if (save)
+        _config.saveReturnSlew(v.as<float>());
+    } else if (strcmp(key, "latencyUs") == 0) {
+      if (!isMeterInts(v, 0, JSON_MAX_LATENCY_US))
+        return fail(ConfigSection::Motion, key,
+                    "expected 3 values of 0-1000000");
+      for (uint8_t i = 0; save && i < 3; i++)
+        _config.saveMeterLatencyUs(i, v[i].as<uint32_t>());
+    } else if (strcmp(key, "returnBudgetMs") == 0) {
+      if (!isMeterInts(v, 0, JSON_MAX_RETURN_MS))
+        return fail(ConfigSection::Motion, key, "expected 3 values of 0-2000");
+      for (uint8_t i = 0; save && i < 3; i++)
+        _config.saveReturnBudgetMs(i, v[i].as<uint16_t>());
+    } else if (!isReadOnly((int8_t)ConfigSection::Motion, key)) {
+      return fail(ConfigSection::Motion, key, "unknown setting");
+    }
+  }
+  return true;
+}
+
+bool ConfigJson::applyLighting(JsonObjectConst values, bool save) {
+  for (JsonPairConst kv : values) {
+    const char *key = kv.key().c_str();
+    JsonVariantConst v = kv.value();
+    if (strcmp(key, "ledCount") == 0) {
+      if (!isInt(v, 1, LED_MAX_COUNT))
+        return fail(ConfigSection::Lighting, key,
+                    "expected 1-" JSON_STR(LED_MAX_COUNT));
+      if (save)
+        _config.saveLedCount(v.as<uint16_t>());
+    } else if (strcmp(key, "schedule") == 0) {
+      LightSchedulePoints s;
+      const char *error = parseSchedule(v, s);
+      if (error)
+        return fail(ConfigSection::Lighting, key, error);
+      if (save)
+        _config.saveLightSchedule(s);
+    } else if (!isReadOnly((int8_t)ConfigSection::Lighting, key)) {
+      return fail(ConfigSection::Lighting, key, "unknown setting");
+    }
+  }
+  return true;
+}
+
+// {"h":[...],"m":[...],"s":[...]}, any of them; a meter's points are always
+// replaced whole
+bool ConfigJson::applyCalibration(JsonObjectConst values, bool save) {
+  CalibrationPoints cal = _config.getCalibration();
+  for (JsonPairConst kv : values) {
+    const char *key = kv.key().c_str();
+    JsonVariantConst v = kv.value();
+    const char *names = "hms";
+    const char *found = key[0] && !key[1] ? strchr(names, key[0]) : nullptr;
+    if (isReadOnly((int8_t)ConfigSection::Calibration, key))
+      continue;
+    if (!found)
+      return fail(ConfigSection::Calibration, key, "unknown meter");
+    uint8_t m = found - names;
+    if (!v.is<JsonArrayConst>() || v.size() < 2 ||
+        v.size() > CalibrationPoints::maxPoints(m))
+      return fail(ConfigSection::Calibration, key,
+                  m == CAL_METER_H
+                      ? "expected 2-" JSON_STR(CAL_MAX_POINTS_H) " points"
+                      : "expected 2-" JSON_STR(CAL_MAX_POINTS_MS) " points");
+    uint8_t n = 0;
+    for (JsonVariantConst p : v.as<JsonArrayConst>()) {
+      if (!isInt(p, 0, JSON_MAX_CAL_VALUE))
+        return fail(ConfigSection::Calibration, key,
+                    "expected points of 0-1023");
+      cal.points(m)[n++] = p.as<uint16_t>();
+    }
+    cal.count[m] = n;
+  }
+  if (save && values.size() > 0)
+    _config.saveCalibration(cal);
+  return true;
+}
+
+bool ConfigJson::fail(ConfigSection section, const char *key,
+                      const char *message) {
+  _error = SECTION_NAMES[(uint8_t)section];
+  if (key) {
+    _error += ".";
+    _error += key;
+  }
+  _error += ": ";
+  _error += message;
+  return false;
+}
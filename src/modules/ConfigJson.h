@@ -0,0 +1,66 @@
+#pragma once
+#include "Config.h"
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// JSON form of the settings, as served at /api/config. One object per
+// ConfigSection, named as configSectionName():
+//   {"generation":12,"network":{"ssid":"..."},"time":{"timezone":"...",...},
+//    "display":{...},"motion":{...},"lighting":{...},"calibration":{...}}
+// network is read-only (WiFi changes go through /save_wifi, which
+// reconnects). GET also shows some state that isn't a setting ("limits",
+// motion.measuredLatencyUs, motion.activeDrive); PATCH skips those keys,
+// and read-only sections whose values are unchanged, so what GET returned
+// can be sent back.
+
+// Capacity for the whole document, schedule and calibration included
+#define CONFIG_JSON_SIZE                                                      \
+  (JSON_OBJECT_SIZE(8) + JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(5) +          \
+   JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(7) + 3 * JSON_ARRAY_SIZE(3) +       \
+   JSON_OBJECT_SIZE(2) + JSON_ARRAY_SIZE(LIGHT_MAX_KEYFRAMES) +               \
+   LIGHT_MAX_KEYFRAMES * JSON_OBJECT_SIZE(4) + JSON_OBJECT_SIZE(3) +          \
+   JSON_ARRAY_SIZE(CAL_MAX_POINTS_H) + 2 * JSON_ARRAY_SIZE(CAL_MAX_POINTS_MS) + \
+   JSON_OBJECT_SIZE(2) + 512)
+
+// Sections a PATCH may change
+#define CONFIG_JSON_WRITABLE                                                   \
+  (CONFIG_SECTION(Time) | CONFIG_SECTION(Display) | CONFIG_SECTION(Motion) |   \
+   CONFIG_SECTION(Lighting) | CONFIG_SECTION(Calibration))
+
+const char *configSectionName(ConfigSection section);
+
+class ConfigJson {
+public:
+  explicit ConfigJson(Config &config);
+
+  // Adds the sections in `sections` (CONFIG_SECTION() bits) to `out`, with
+  // the read-only state that goes with them
+  void write(JsonObject out, uint32_t sections);
+  void writeSection(JsonObject out, ConfigSection section);
+
+  // Applies a partial document. Every value is checked before anything is
+  // saved, then all of it is saved in one Config::Transaction, so the frame
+  // loop and flash see the whole patch or none of it. A top-level
+  // "generation" must match the current one (the caller's copy is stale
+  // otherwise). Returns an HTTP status; see getError() when it isn't 200.
+  int patch(JsonObjectConst doc);
+  int patchSection(ConfigSection section, JsonObjectConst values);
+
+  const String &getError() const { return _error; }
+  bool changed() const { return _changed; }
+
+private:
+  Config &_config;
+  String _error;
+  bool _changed;
+
+  void writeSettings(JsonObject out, ConfigSection section);
+  bool matches(ConfigSection section, JsonVariantConst values);
+  bool apply(ConfigSection section, JsonObjectConst values, bool save);
+  bool applyTime(JsonObjectConst values, bool save);
+  bool applyDisplay(JsonObjectConst values, bool save);
+  bool applyMotion(JsonObjectConst values, bool save);
+  bool applyLighting(JsonObjectConst values, bool save);
+  bool applyCalibration(JsonObjectConst values, bool save);
+  bool fail(ConfigSection section, const char *key, const char *message);
+};
@@ -0,0 +1,120 @@
+#include "FrameScheduler.h"
+#include <sys/time.h>
+
+FrameScheduler::FrameScheduler()
+    : _timer(nullptr), _waiter(nullptr), _leadUs(0), _fps(FRAME_FPS_SMOOTH),
+      _armedFps(FRAME_FPS_SMOOTH), _arming(false), _due(false), _aimUs(0),
+      _nextUs(0), _landingUs(0), _frames(0), _steps(0), _minUs(0),
+      _maxUs(0), _avgQ4(0), _resetRequested(false) {}
+
+void FrameScheduler::begin() {
+  _waiter = xTaskGetCurrentTaskHandle(); // loop() runs in this task
+
+  esp_timer_create_args_t args = {};
+  args.callback = onTimer;
+  args.arg = this;
+  args.name = "frame";
+  esp_timer_create(&args, &_timer);
+  arm();
+}
+
+int64_t FrameScheduler::wallMicros() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+// Arm the one-shot for the next boundary that is still more than `lead`
+// away. The wall clock is re-read every frame, so NTP slewing and clock
+// steps are picked up on the next frame. Runs from the timer callback, and
+// from wait() only when the timer has stopped; the flag keeps the two from
+// interleaving on _nextUs/_aimUs.
+void FrameScheduler::arm() {
+  if (_arming.exchange(true, std::memory_order_acquire))
+    return; // The other one is arming it
+  _armedFps = _fps.load(std::memory_order_relaxed);
+  int64_t period = 1000000 / _armedFps;
+  int64_t lead = _leadUs;
+  int64_t now = wallMicros();
+
+  int64_t next = ((now + lead) / period + 1) * period;
+  // Timer fired a hair early: don't repeat a frame. Anything further back
+  // is the clock being set backwards, so follow it.
+  if (next <= _landingUs && _landingUs - next <= period)
+    next = _landingUs + period;
+
+  _nextUs = next;
+  _aimUs = next - lead;
+  esp_timer_start_once(_timer, _aimUs - now);
+  _arming.store(false, std::memory_order_release);
+}
+
+void FrameScheduler::setFramesPerSecond(uint8_t fps) {
+  if (fps != 0)
+    _fps.store(fps, std::memory_order_relaxed);
+}
+
+void FrameScheduler::onTimer(void *arg) {
+  FrameScheduler *self = (FrameScheduler *)arg;
+  self->recordError((int32_t)(wallMicros() - self->_aimUs));
+  self->_landingUs = self->_nextUs;
+  self->_due = true;
+#if CLOCK_RTOS_TASKS
+  xTaskNotifyGive(self->_waiter);
+#endif
+  self->arm();
+}
+
+bool FrameScheduler::wait(uint32_t timeoutMs) {
+#if CLOCK_RTOS_TASKS
+  if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeoutMs)) == 0) {
+    // Nothing arrived; make sure the timer is still running
+    if (!esp_timer_is_active(_timer))
+      arm();
+    return false;
+  }
+#endif
+  if (!_due)
+    return false;
+  _due = false;
+  return true;
+}
+
+int32_t FrameScheduler::getAheadUs() const {
+  int64_t ahead = _landingUs - wallMicros();
+  return ahead > 0 ? (int32_t)ahead : 0;
+}
+
+void FrameScheduler::recordError(int32_t errUs) {
+  if (_resetRequested) {
+    _resetRequested = false;
+    _frames = 0;
+    _steps = 0;
+  }
+  if (errUs > FRAME_STEP_LIMIT_US || errUs < -FRAME_STEP_LIMIT_US) {
+    _steps++;
+    return;
+  }
+  if (_frames == 0 || errUs < _minUs)
+    _minUs = errUs;
+  if (_frames == 0 || errUs > _maxUs)
+    _maxUs = errUs;
+  if (_frames == 0)
+    _avgQ4 = errUs * 16;
+  else
+    _avgQ4 += (errUs * 16 - _avgQ4) / 16;
+  _frames++;
+}
+
+FrameStats FrameScheduler::getStats() {
+  FrameStats s;
+  s.frames = _frames;
+  s.steps = _steps;
+  s.minUs = _minUs;
+  s.maxUs = _maxUs;
+  s.avgUs = _avgQ4 / 16;
+  return s;
+}
+
+// Cleared by the timer callback on its next frame, so it never races
+void FrameScheduler::resetStats() { _resetRequested = true; }
@@ -0,0 +1,83 @@
+#pragma once
+#include "Tasks.h"
+#include <Arduino.h>
+#include <atomic>
+#include "esp_timer.h"
+
+// Frames per second: ticking seconds only need the second boundary,
+// smooth seconds, calibration and the error flash want sub-frames.
+#define FRAME_FPS_TICK 1
+#define FRAME_FPS_SMOOTH 20
+
+// loop() wakes at least this often even if the frame timer stalls
+#define FRAME_WAIT_MS 1500
+
+// Frames further off than this are treated as clock steps (NTP, RTC,
+// manual set) and left out of the stats
+#define FRAME_STEP_LIMIT_US 100000
+
+// How far the frame timer fired from its aim point
+struct FrameStats {
+  uint32_t frames;
+  uint32_t steps; // Frames skipped from the stats due to a clock step
+  int32_t minUs;
+  int32_t maxUs;
+  int32_t avgUs; // Moving average over roughly the last 16 frames
+};
+
+// Wakes loop() on wall-clock frame boundaries (whole seconds, or 1/fps
+// slices of them) minus a lead time, so a needle that needs `lead` to
+// travel arrives on the edge instead of up to a frame late.
+class FrameScheduler {
+public:
+  FrameScheduler();
+  void begin();
+
+  // Lead time: how long before the boundary the frame is computed
+  void setLeadUs(uint32_t us) { _leadUs = us; }
+  uint32_t getLeadUs() const { return _leadUs; }
+
+  // Any task: only stores the rate, which arm() picks up the next time it
+  // runs, so it applies from the frame after the one already armed. arm()
+  // runs from the timer callback, and from wait() when the timer has
+  // stopped (threaded builds, after timeoutMs with no frame); _arming keeps
+  // those two from interleaving.
+  void setFramesPerSecond(uint8_t fps);
+  // Rate the armed timer runs at, i.e. of the frame being computed
+  uint8_t getFramesPerSecond() const { return _armedFps; }
+
+  // Call at the top of loop(). True when a frame is due. Threaded: blocks
+  // until then (or timeoutMs). Cooperative: returns false straight away.
+  bool wait(uint32_t timeoutMs);
+
+  // How far ahead of now the current frame lands; pass to capture()
+  int32_t getAheadUs() const;
+
+  FrameStats getStats();
+  void resetStats();
+
+private:
+  esp_timer_handle_t _timer;
+  TaskHandle_t _waiter;
+  volatile uint32_t _leadUs;
+  std::atomic<uint8_t> _fps; // Requested
+  volatile uint8_t _armedFps;
+  std::atomic<bool> _arming; // arm() in progress
+  volatile bool _due;
+  volatile int64_t _aimUs;     // Wall-clock time the timer was armed for
+  volatile int64_t _nextUs;    // Boundary the armed timer is for
+  volatile int64_t _landingUs; // Boundary the current frame is for
+
+  // Stats (written by the timer callback only)
+  volatile uint32_t _frames;
+  volatile uint32_t _steps;
+  volatile int32_t _minUs;
+  volatile int32_t _maxUs;
+  volatile int32_t _avgQ4; // EWMA, 4 fractional bits
+  volatile bool _resetRequested;
+
+  static int64_t wallMicros();
+  void arm();
+  void recordError(int32_t errUs);
+  static void onTimer(void *arg);
+};
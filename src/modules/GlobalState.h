@@ -1,8 +1,13 @@
 #pragma once
+#include "Snapshot.h"
 
 // Global State for Calibration Mode
-// These are defined in main.cpp and extern'd here for Network.cpp
+// Defined in main.cpp. Published only by the frame loop (applyCommands() and
+// applyPreview()), read there once per frame and by the web handlers
+// (async_tcp task) to report the mode.
+struct CalibrationOverride {
+  bool active;
+  int16_t value[3]; // 0=Hour, 1=Minute, 2=Second. -1 = No Override
+};
 
-extern bool g_isCalibrationMode;
-extern int
-    g_calOverrideValues[3]; // 0=Hour, 1=Minute, 2=Second. -1 = No Override
+extern Snapshot<CalibrationOverride> g_calibration;
@@ -0,0 +1,117 @@
+#include "LedOutput.h"
+
+// One RMT item per bit: high for T*H, then low for T*L
+#define LED_ITEM(high, low) ((high) | (1u << 15) | ((uint32_t)(low) << 16))
+
+// Latch: the strip shows the frame after the line idles low this long
+#define LED_RESET_US 50
+
+static inline uint8_t scaleChannel(uint8_t v, uint8_t scale) {
+  return ((uint16_t)v * (1 + scale)) >> 8;
+}
+
+LedOutput::LedOutput()
+    : _ready(false), _count(0), _correction(CRGB::White), _force(true),
+      _sent(0), _skipped(0) {
+  _order[0] = 0;
+  _order[1] = 1;
+  _order[2] = 2;
+}
+
+bool LedOutput::begin(uint8_t pin, uint16_t count, EOrder order) {
+  // EOrder packs the channel for each wire position in octal digits
+  _order[0] = (order >> 6) & 3;
+  _order[1] = (order >> 3) & 3;
+  _order[2] = order & 3;
+
+  rmt_config_t cfg = RMT_DEFAULT_CONFIG_TX((gpio_num_t)pin, LED_RMT_CHANNEL);
+  cfg.clk_div = LED_RMT_CLK_DIV;
+  cfg.mem_block_num = LED_RMT_MEM_BLOCKS;
+  if (rmt_config(&cfg) != ESP_OK ||
+      rmt_driver_install(LED_RMT_CHANNEL, 0, 0) != ESP_OK ||
+      rmt_translator_init(LED_RMT_CHANNEL, translate) != ESP_OK) {
+    Serial.println("LED output: RMT init failed");
+    return false;
+  }
+  _ready = true;
+  _count = min(count, (uint16_t)LED_MAX_COUNT);
+  return true;
+}
+
+// Converts frame bytes to RMT items, MSB first. Runs in the RMT interrupt
+// as the channel memory drains.
+void IRAM_ATTR LedOutput::translate(const void *src, rmt_item32_t *dest,
+                                    size_t srcSize, size_t wanted,
+                                    size_t *translated, size_t *items) {
+  const uint8_t *p = (const uint8_t *)src;
+  size_t size = 0;
+  size_t num = 0;
+  while (size < srcSize && num + 8 <= wanted) {
+    uint8_t b = p[size++];
+    for (uint8_t bit = 0; bit < 8; bit++, b <<= 1)
+      (dest + num++)->val =
+          (b & 0x80) ? LED_ITEM(LED_T1H, LED_T1L) : LED_ITEM(LED_T0H, LED_T0L);
+  }
+  *translated = size;
+  *items = num;
+}
+
+void LedOutput::setCount(uint16_t count) {
+  count = min(count, (uint16_t)LED_MAX_COUNT);
+  if (count == _count)
+    return;
+  if (_ready && count < _count) {
+    // Turn off the pixels that drop out of the frame
+    wait();
+    memset(_wire, 0, _count * 3);
+    rmt_write_sample(LED_RMT_CHANNEL, _wire, _count * 3, true);
+  }
+  _count = count;
+  _force = true;
+}
+
+bool LedOutput::show(const CRGB *leds, uint8_t brightness) {
+  if (!_ready)
+    return false;
+
+  uint8_t adj[3];
+  for (uint8_t c = 0; c < 3; c++)
+    adj[c] = scaleChannel(_correction[c], brightness);
+
+  size_t bytes = _count * 3;
+  uint8_t *out = _frame;
+  for (uint16_t i = 0; i < _count; i++) {
+    for (uint8_t w = 0; w < 3; w++) {
+      uint8_t c = _order[w];
+      *out++ = scaleChannel(leds[i][c], adj[c]);
+    }
+  }
+
+  if (!_force && memcmp(_frame, _wire, bytes) == 0) {
+    _skipped++;
+    return false;
+  }
+  if (busy())
+    return false; // _wire differs, so the next show() retries
+
+  memcpy(_wire, _frame, bytes);
+  rmt_write_sample(LED_RMT_CHANNEL, _wire, bytes, false);
+  _force = false;
+  _sent++;
+  return true;
+}
+
+bool LedOutput::busy() {
+  return _ready && rmt_wait_tx_done(LED_RMT_CHANNEL, 0) != ESP_OK;
+}
+
+void LedOutput::wait() {
+  if (_ready)
+    rmt_wait_tx_done(LED_RMT_CHANNEL, portMAX_DELAY);
+}
+
+uint32_t LedOutput::wireTimeUs(uint16_t count) {
+  // 24 bits of (T*H + T*L) ticks, 25 ns each
+  uint32_t bitNs = (LED_T0H + LED_T0L) * 25;
+  return (uint32_t)count * 24 * bitNs / 1000 + LED_RESET_US;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include "driver/rmt.h"
+
+// Longest strip the buffers are sized for (bezel ring)
+#define LED_MAX_COUNT 144
+
+// One RMT channel with the memory of four, so the refill interrupt runs
+// every 32 pixels instead of every 8
+#define LED_RMT_CHANNEL RMT_CHANNEL_0
+#define LED_RMT_MEM_BLOCKS 4
+#define LED_RMT_CLK_DIV 2 // 80 MHz APB / 2 = 25 ns ticks
+
+// WS2811 (800 kHz) bit timings in RMT ticks, same as FastLED's 320/320/640 ns
+#define LED_T0H 13
+#define LED_T0L 38
+#define LED_T1H 26
+#define LED_T1L 26
+
+// Pushes pixels to a WS2811 strip through the RMT peripheral. show() only
+// encodes the frame and starts the transfer; the bits go out from the RMT
+// interrupt while the CPU carries on. Frames identical to the last one
+// sent are skipped.
+class LedOutput {
+public:
+  LedOutput();
+  bool begin(uint8_t pin, uint16_t count, EOrder order);
+
+  // Blanks LEDs beyond the new length. Waits for a transfer in progress.
+  void setCount(uint16_t count);
+  uint16_t getCount() const { return _count; }
+
+  // Colour correction per channel, as FastLED's setCorrection()
+  void setCorrection(uint32_t rgb) { _correction = CRGB(rgb); }
+
+  // Returns false when the frame was skipped (unchanged, or the previous
+  // frame is still on the wire; the next show() sends it then)
+  bool show(const CRGB *leds, uint8_t brightness);
+  bool busy();
+  void wait();          // Until the current transfer is out
+  void invalidate() { _force = true; } // Resend on the next show()
+
+  uint32_t getSent() const { return _sent; }
+  uint32_t getSkipped() const { return _skipped; }
+
+  // Time the strip needs for one frame of `count` pixels
+  static uint32_t wireTimeUs(uint16_t count);
+
+private:
+  bool _ready;
+  uint16_t _count;
+  uint8_t _order[3]; // CRGB channel sent first, second, third
+  CRGB _correction;
+  bool _force;
+  uint32_t _sent;
+  uint32_t _skipped;
+
+  uint8_t _frame[LED_MAX_COUNT * 3]; // Encoded, next to send
+  uint8_t _wire[LED_MAX_COUNT * 3];  // Being sent; RMT reads it from the ISR
+
+  static void IRAM_ATTR translate(const void *src, rmt_item32_t *dest,
+                                  size_t srcSize, size_t wanted,
+                                  size_t *translated, size_t *items);
+};
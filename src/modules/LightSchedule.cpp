@@ -0,0 +1,39 @@
+#include "LightSchedule.h"
+
+ScheduleTable::ScheduleTable() : _count(1) {
+  memset(_keys, 0, sizeof(_keys));
+  memset(_index, 0, sizeof(_index));
+}
+
+void ScheduleTable::build(const LightSchedulePoints &schedule) {
+  _count = constrain(schedule.count, 1, LIGHT_MAX_KEYFRAMES);
+
+  // Insertion sort by minute (at most 16 keyframes)
+  for (uint8_t i = 0; i < _count; i++) {
+    LightKeyframe k = schedule.keys[i];
+    k.minute %= LIGHT_MINUTES_PER_DAY;
+    uint8_t j = i;
+    while (j > 0 && _keys[j - 1].minute > k.minute) {
+      _keys[j] = _keys[j - 1];
+      j--;
+    }
+    _keys[j] = k;
+  }
+
+  // Before the first keyframe of the day the last one is still in effect
+  uint8_t active = _count - 1;
+  uint8_t next = 0;
+  for (uint16_t m = 0; m < LIGHT_MINUTES_PER_DAY; m++) {
+    while (next < _count && _keys[next].minute <= m)
+      active = next++;
+    uint8_t &b = _index[m >> 1];
+    b = (m & 1) ? (b & 0x0F) | (active << 4) : (b & 0xF0) | active;
+  }
+}
+
+const LightKeyframe &ScheduleTable::at(uint16_t minute) const {
+  if (minute >= LIGHT_MINUTES_PER_DAY)
+    minute %= LIGHT_MINUTES_PER_DAY;
+  uint8_t b = _index[minute >> 1];
+  return _keys[(minute & 1) ? b >> 4 : b & 0x0F];
+}
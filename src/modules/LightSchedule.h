@@ -0,0 +1,27 @@
+#pragma once
+#include "Config.h"
+#include <Arduino.h>
+
+#define LIGHT_MINUTES_PER_DAY 1440
+
+// Lighting schedule compiled to a minute-of-day table. build() sorts the
+// keyframes and stores the active one for every minute as a 4-bit index
+// (720 bytes), so at() is one table read with no Config access per frame.
+class ScheduleTable {
+public:
+  ScheduleTable();
+
+  void build(const LightSchedulePoints &schedule);
+
+  // Keyframe in effect at a minute of the day
+  const LightKeyframe &at(uint16_t minute) const;
+
+  // Keyframes in time order
+  uint8_t count() const { return _count; }
+  const LightKeyframe &key(uint8_t i) const { return _keys[i]; }
+
+private:
+  LightKeyframe _keys[LIGHT_MAX_KEYFRAMES]; // Sorted by minute
+  uint8_t _count;
+  uint8_t _index[LIGHT_MINUTES_PER_DAY / 2]; // Two minutes per byte
+};
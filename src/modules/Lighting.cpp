@@ -1,70 +1,202 @@
 #include "Lighting.h"
 
-Lighting::Lighting() {}
+// Compile-time curves from an 8-bit position to 16-bit linear light.
+// Colours fade along an LED gamma curve and brightness along CIE L*, so a
+// fade looks even instead of rushing through the dim end.
+namespace {
+struct Curve {
+  uint16_t v[256];
+};
+
+constexpr double squareRoot(double x) {
+  double r = 1.0;
+  for (int i = 0; i < 30; i++)
+    r = 0.5 * (r + x / r);
+  return r;
+}
+
+constexpr double gamma25(double x) { return x * x * squareRoot(x); }
+
+constexpr double lightness(double l) {
+  l *= 100.0;
+  double f = (l + 16.0) / 116.0;
+  return l > 8.0 ? f * f * f : l / 903.3;
+}
+
+constexpr Curve makeCurve(double (*fn)(double)) {
+  Curve c{};
+  for (int i = 0; i < 256; i++)
+    c.v[i] = (uint16_t)(fn(i / 255.0) * 65535.0 + 0.5);
+  return c;
+}
+
+constexpr Curve GAMMA = makeCurve(gamma25);
+constexpr Curve LIGHTNESS = makeCurve(lightness);
 
-void Lighting::begin() {
-  FastLED.addLeds<LED_TYPE, LED_DATA_PIN, COLOR_ORDER>(_leds, NUM_LEDS)
-      .setCorrection(TypicalLEDStrip);
-  FastLED.setBrightness(128);
-  fill_solid(_leds, NUM_LEDS, CRGB::Black);
-  FastLED.show();
+// Curve value at a Q8 position, interpolated between table entries
+uint16_t curveAt(const Curve &c, uint16_t q8) {
+  uint8_t i = q8 >> 8;
+  if (i == 255)
+    return c.v[255];
+  return c.v[i] + (((int32_t)(c.v[i + 1] - c.v[i]) * (q8 & 0xFF)) >> 8);
 }
 
-void Lighting::setColor(int index, CRGB color) {
-  if (index >= 0 && index < NUM_LEDS) {
-    _leds[index] = color;
+// Q8 position where the curve reaches `v` (binary search, fade starts only)
+uint16_t curvePos(const Curve &c, uint16_t v) {
+  uint16_t lo = 0, hi = 255 << 8;
+  while (lo < hi) {
+    uint16_t mid = (lo + hi + 1) / 2;
+    if (curveAt(c, mid) <= v)
+      lo = mid;
+    else
+      hi = mid - 1;
   }
+  return lo;
+}
+// a + (b - a) * t, t in Q16 (0x10000 = b)
+uint16_t lerpQ8(uint16_t a, uint16_t b, uint32_t tQ16) {
+  return a + (((int32_t)(b - a) * (int32_t)(tQ16 >> 1)) >> 15);
+}
+} // namespace
+
+Lighting::Lighting() {}
+
+void Lighting::begin(uint16_t count) {
+  _wantCount = count;
+  _output.begin(LED_DATA_PIN, count, COLOR_ORDER);
+  fill_solid(_leds, LED_MAX_COUNT, CRGB::Black);
+  _output.show(_leds, 255);
 }
 
-void Lighting::update(int hour, int minute, Config &config, bool isError) {
-  if (isError) {
-    // Flash LED 1 Red, others OFF
-    fill_solid(_leds, NUM_LEDS, CRGB::Black);
-    if ((millis() / 500) % 2 == 0) { // 1Hz Flash
-      _leds[0] = CRGB::Red;          // LED 1
-    }
+void Lighting::update(const LightKeyframe &look, bool isError) {
+  _error = isError;
+  if (isError)
     return;
+  _fadeUs = (uint32_t)look.fadeSec * 1000000UL;
+  _target = ((uint32_t)look.brightness << 24) | (look.color & 0xFFFFFF);
+}
+
+bool Lighting::refresh() {
+  unsigned long now = micros();
+  unsigned long elapsed = now - _lastRefresh;
+  if (elapsed < LIGHT_REFRESH_US)
+    return false;
+  _lastRefresh = now;
+
+  if (_benchRequested) {
+    _benchRequested = false;
+    runBenchmark();
   }
+  if (_wantCount != getCount())
+    _output.setCount(_wantCount);
 
-  // Get settings from Config
-  uint8_t nightStart = config.getNightStart();
-  uint8_t nightStartMin = config.getNightStartMinute();
-  uint8_t nightEnd = config.getNightEnd();
-  uint8_t nightEndMin = config.getNightEndMinute();
-
-  // Convert everything to minutes from midnight
-  int currentMin = (hour * 60) + minute;
-  int startMin = (nightStart * 60) + nightStartMin;
-  int endMin = (nightEnd * 60) + nightEndMin;
-
-  bool isNight = false;
-  if (startMin > endMin) {
-    // Example: Start 21:30 (1290), End 07:15 (435)
-    // Night is: current >= 1290 OR current < 435
-    if (currentMin >= startMin || currentMin < endMin)
-      isNight = true;
+  bool preview = previewActive();
+  if (_error && !preview) {
+    renderError();
   } else {
-    // Example: Start 01:00 (60), End 05:00 (300)
-    // Night is: current >= 60 AND current < 300
-    if (currentMin >= startMin && currentMin < endMin)
-      isNight = true;
+    uint32_t target = preview ? _preview : _target;
+    if (target != _fadeTarget)
+      startFade(target);
+    if (preview || _previewShown)
+      _progressQ16 = 0x10000; // Into and out of a preview without a fade
+    renderFade(elapsed);
   }
+  _previewShown = preview;
+  _output.show(_leds, 255);
+  return true;
+}
 
-  CRGB targetColor;
-  uint8_t brightness;
+void Lighting::setPreview(uint32_t color, uint8_t brightness) {
+  _preview = ((uint32_t)brightness << 24) | (color & 0xFFFFFF);
+  _previewMs = max(millis(), 1UL);
+}
 
-  if (isNight) {
+bool Lighting::previewActive() {
+  uint32_t since = _previewMs;
+  if (since && millis() - since >= LIGHT_PREVIEW_TIMEOUT_MS) {
+    // Unless a new one has just come in
+    _previewMs.compare_exchange_strong(since, 0);
+    return false;
+  }
+  return since != 0;
+}
 
-    targetColor = CRGB(config.getNightColor());
-    brightness = config.getNightBrightness();
-  } else {
+// Retargeting mid-fade carries on from wherever the fade has got to
+void Lighting::startFade(uint32_t target) {
+  for (uint8_t c = 0; c < 4; c++)
+    _fromQ8[c] = lerpQ8(_fromQ8[c], _toQ8[c], _progressQ16);
 
-    targetColor = CRGB(config.getDayColor());
-    brightness = config.getDayBrightness();
+  for (uint8_t c = 0; c < 3; c++) {
+    uint8_t v = target >> (16 - 8 * c);
+    _toQ8[c] = curvePos(GAMMA, v * 257);
   }
+  _toQ8[3] = curvePos(LIGHTNESS, (target >> 24) * 257);
+  _fadeTarget = target;
+  _progressQ16 = 0;
+}
+
+void Lighting::renderFade(uint32_t elapsedUs) {
+  // Progress is advanced by the time since the last LED frame
+  uint32_t fadeUs = _fadeUs;
+  if (fadeUs == 0)
+    _progressQ16 = 0x10000;
+  else if (_progressQ16 < 0x10000)
+    _progressQ16 += ((uint64_t)elapsedUs << 16) / fadeUs;
+  if (_progressQ16 > 0x10000)
+    _progressQ16 = 0x10000;
 
-  FastLED.setBrightness(brightness);
-  fill_solid(_leds, NUM_LEDS, targetColor);
+  uint16_t pos[4];
+  for (uint8_t c = 0; c < 4; c++)
+    pos[c] = lerpQ8(_fromQ8[c], _toQ8[c], _progressQ16);
+
+  // 16-bit linear level per channel, then temporal dithering: the fraction
+  // below 8 bits is carried, so the average over a few frames is exact
+  static const CRGB correction = CRGB(LED_CORRECTION);
+  uint32_t bright = curveAt(LIGHTNESS, pos[3]);
+  uint8_t out[3];
+  for (uint8_t c = 0; c < 3; c++) {
+    uint32_t level = (curveAt(GAMMA, pos[c]) * bright) >> 16;
+    level = (level * (correction[c] + 1)) >> 8;
+    level += _dither[c];
+    _dither[c] = level & 0xFF;
+    out[c] = min(level >> 8, (uint32_t)255);
+  }
+  fill_solid(_leds, getCount(), CRGB(out[0], out[1], out[2]));
 }
 
-void Lighting::show() { FastLED.show(); }
+void Lighting::renderError() {
+  // Flash LED 1 Red, others OFF
+  fill_solid(_leds, getCount(), CRGB::Black);
+  if ((millis() / 500) % 2 == 0) // 1Hz Flash
+    _leds[0] = CRGB(LIGHT_ERROR_BRIGHTNESS, 0, 0); // LED 1
+}
+
+void Lighting::runBenchmark() {
+  static const uint16_t counts[LED_BENCH_STEPS] = LED_BENCH_COUNTS;
+  uint16_t restore = getCount();
+  CRGB saved[LED_MAX_COUNT];
+  memcpy(saved, _leds, sizeof(_leds));
+
+  Serial.println("LED benchmark (count, show us, wire us):");
+  for (uint8_t i = 0; i < LED_BENCH_STEPS; i++) {
+    _output.wait();
+    _output.setCount(counts[i]);
+    fill_solid(_leds, counts[i], (i & 1) ? CRGB::Blue : CRGB::Red);
+
+    unsigned long t0 = micros();
+    _output.show(_leds, 255);
+    unsigned long t1 = micros();
+    _output.wait();
+    unsigned long t2 = micros();
+
+    _bench[i].count = counts[i];
+    _bench[i].showUs = t1 - t0;
+    _bench[i].wireUs = t2 - t0;
+    Serial.printf("  %3u %5lu %5lu\r\n", counts[i], t1 - t0, t2 - t0);
+  }
+
+  memcpy(_leds, saved, sizeof(_leds));
+  _output.setCount(restore);
+  _output.invalidate();
+  _benchDone = true;
+}
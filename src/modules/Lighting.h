@@ -1,22 +1,95 @@
 #pragma once
 #include "Config.h"
+#include "LedOutput.h"
 #include <FastLED.h>
+#include <atomic>
 
-#define NUM_LEDS 3
+#define LED_DEFAULT_COUNT 3
 #define LED_DATA_PIN 13 // Default pin, can be changed
-#define LED_TYPE WS2811
 #define COLOR_ORDER RGB
+#define LED_CORRECTION TypicalLEDStrip
+
+// LED frames (crossfade steps and dithering) run this often from the
+// housekeeping task, independent of the clock frame rate
+#define LIGHT_REFRESH_US 5000
+
+// Connection error flash: LED 1 red at this level, 1 Hz
+#define LIGHT_ERROR_BRIGHTNESS 128
+
+// A preview is dropped this long after the last setPreview()
+#define LIGHT_PREVIEW_TIMEOUT_MS 30000
+
+// Strip lengths timed by the LED benchmark
+#define LED_BENCH_STEPS 7
+#define LED_BENCH_COUNTS {3, 16, 30, 60, 90, 120, 144}
+
+struct LedBenchResult {
+  uint16_t count;
+  uint32_t showUs; // CPU time in show(): encode and start the transfer
+  uint32_t wireUs; // Until the last bit is out
+};
 
 class Lighting {
 public:
   Lighting();
-  void begin();
-  void setColor(int index, CRGB color);
-  void update(int hour, int minute, Config &config, bool isError = false);
-  void show();
+  void begin(uint16_t count = LED_DEFAULT_COUNT);
+
+  // Clock frame: the schedule keyframe in effect. A new look fades in over
+  // the keyframe's fadeSec rather than switching.
+  void update(const LightKeyframe &look, bool isError = false);
+
+  // LED frame: call often from one task. Steps the crossfade, dithers and
+  // sends (unchanged frames are not resent). False if not due yet.
+  bool refresh();
+
+  // LED page preview: shown instead of update()'s look (and the error
+  // flash) from the next LED frame, switching both ways without a fade,
+  // until clearPreview() or the timeout. RAM only. Any task; calls between
+  // two LED frames coalesce to the last.
+  void setPreview(uint32_t color, uint8_t brightness);
+  void clearPreview() { _previewMs = 0; }
+  bool isPreviewing() const { return _previewMs != 0; }
+
+  void setCount(uint16_t count) { _wantCount = count; }
+  uint16_t getCount() const { return _output.getCount(); }
+
+  // Times one frame at each LED_BENCH_COUNTS length on the next refresh().
+  // The strip flashes while it runs.
+  void requestBenchmark() { _benchRequested = true; }
+  bool hasBenchmark() const { return _benchDone; }
+  const LedBenchResult *getBenchmark() const { return _bench; }
 
 private:
-  CRGB _leds[NUM_LEDS];
-  CRGB _dayColor = CRGB::White;
-  CRGB _nightColor = CRGB::Purple;
+  CRGB _leds[LED_MAX_COUNT];
+  LedOutput _output;
+
+  // Written by update(), read by refresh()
+  volatile uint32_t _target = 0; // Brightness << 24 | 0xRRGGBB
+  volatile uint32_t _fadeUs = 0;
+  volatile bool _error = false;
+  volatile uint16_t _wantCount = LED_DEFAULT_COUNT;
+
+  // Written by setPreview(), timed out by refresh()
+  volatile uint32_t _preview = 0;      // Brightness << 24 | 0xRRGGBB
+  std::atomic<uint32_t> _previewMs{0}; // millis() of the last, 0 = off
+  bool _previewShown = false;          // refresh() only
+
+  // Crossfade state (refresh() only). Colour channels are positions on
+  // the gamma curve, brightness on the lightness curve; Q8 table indexes.
+  uint32_t _fadeTarget = 0;
+  uint16_t _fromQ8[4] = {0, 0, 0, 0};
+  uint16_t _toQ8[4] = {0, 0, 0, 0};
+  uint32_t _progressQ16 = 0x10000; // 0x10000 = arrived
+  unsigned long _lastRefresh = 0;
+  uint8_t _dither[3] = {0, 0, 0}; // Fractions carried to the next frame
+
+  volatile bool _benchRequested = false;
+  volatile bool _benchDone = false;
+  LedBenchResult _bench[LED_BENCH_STEPS];
+
+  bool previewActive();
+  void startFade(uint32_t target);
+  void renderFade(uint32_t elapsedUs);
+  void renderError();
+  void runBenchmark();
 };
@@ -1,4 +1,38 @@
 #include "Meter.h"
+#include "driver/ledc.h"
+
+// The fade ISR is shared by all channels; install it once
+static bool s_fadeInstalled = false;
+
+// Profile constants in Q16 per tick (METER_TICK_US = 1 ms)
+#define Q16(x) ((int32_t)((x) * 65536.0f))
+static const int32_t SLEW_Q16 = Q16(METER_SLEW_PER_MS); // Linear / max speed
+static const int32_t ACCEL_Q16 = Q16(METER_SLEW_PER_MS / 60.0f); // 60 ms to vmax
+// Second order: accel = k * error - c * velocity, with k = w^2, c = 2*zeta*w
+#define DAMPED_W 0.033f   // rad/ms, zeta = 1
+#define VINTAGE_W 0.025f  // rad/ms
+#define VINTAGE_ZETA 0.35f // ~30% overshoot
+static const int32_t DAMPED_K = Q16(DAMPED_W * DAMPED_W);
+static const int32_t DAMPED_C = Q16(2.0f * DAMPED_W);
+static const int32_t VINTAGE_K = Q16(VINTAGE_W * VINTAGE_W);
+static const int32_t VINTAGE_C = Q16(2.0f * VINTAGE_ZETA * VINTAGE_W);
+
+static uint32_t isqrt64(uint64_t v) {
+  uint64_t res = 0;
+  uint64_t bit = 1ULL << 62;
+  while (bit > v)
+    bit >>= 2;
+  while (bit) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint32_t)res;
+}
 
 Meter::Meter(int pin, int channel) : _pin(pin), _channel(channel) {}
 
@@ -8,6 +42,75 @@ void Meter::begin() {
   // We stick to v2 as it's commonly compatible with many libs.
   ledcSetup(_channel, _freq, _resolution);
   ledcAttachPin(_pin, _channel);
+  _lastTick = micros();
+}
+
+bool Meter::setDrive(MeterDrive drive) {
+  if (drive == MeterDrive::HardwareFade && !s_fadeInstalled) {
+    if (ledc_fade_func_install(0) != ESP_OK) {
+      Serial.println("LEDC fade unavailable, using software ramp");
+      _requestedDrive = MeterDrive::Software;
+      return false;
+    }
+    s_fadeInstalled = true;
+  }
+  _requestedDrive = drive;
+  return true;
+}
+
+void Meter::applyModeChanges() {
+  MeterDrive drive = _requestedDrive;
+  MotionProfile profile = _requestedProfile;
+  if (drive == _drive && profile == _profile)
+    return;
+
+  // Pick up from wherever the needle currently is
+  _posQ16 = (int32_t)_duty << 16;
+  _velQ16 = 0;
+  _settled = false;
+  _drive = drive;
+  _profile = profile;
+
+  _returnSlew = 0;
+
+  // Old latency samples describe the previous motion
+  _probeDir = 0;
+  _latencyQ4 = 0;
+}
+
+uint32_t Meter::estimateLatencyUs(float delta) const {
+  delta = fabsf(delta);
+  float ms = 0;
+  if (_requestedDrive == MeterDrive::HardwareFade) {
+    ms = delta / METER_SLEW_PER_MS;
+  } else {
+    float vmax = METER_SLEW_PER_MS;
+    float accel = METER_SLEW_PER_MS / 60.0f;
+    switch ((MotionProfile)_requestedProfile) {
+    case MotionProfile::Linear:
+      ms = delta / vmax;
+      break;
+    case MotionProfile::SCurve:
+      // Triangular profile for short moves, trapezoid once vmax is reached
+      if (delta <= vmax * vmax / accel)
+        ms = 2.0f * sqrtf(delta / accel);
+      else
+        ms = delta / vmax + vmax / accel;
+      break;
+    case MotionProfile::Damped:
+      // e^-wt (1 + wt) * delta falls below half a unit
+      ms = delta > 0.5f ? (logf(2.0f * delta) + 1.5f) / DAMPED_W : 0;
+      break;
+    case MotionProfile::Vintage:
+      // First crossing of the target (rise time)
+      if (delta > 0.5f)
+        ms = (3.14159f - acosf(VINTAGE_ZETA)) /
+             (VINTAGE_W * sqrtf(1.0f - VINTAGE_ZETA * VINTAGE_ZETA));
+      break;
+    }
+  }
+  // On average the target waits half a servo tick before it is picked up
+  return (uint32_t)(ms * 1000.0f) + METER_TICK_US / 2 + METER_RC_TAU_US;
 }
 
 void Meter::setValue(int value) {
@@ -16,9 +119,11 @@ void Meter::setValue(int value) {
   if (value < 0)
     value = 0;
 
-  _targetVal = value;
-  _currentVal = value; // Instant set
-  ledcWrite(_channel, value);
+  _targetQ16 = (int32_t)value << 16;
+  _posQ16 = _targetQ16; // Instant set
+  _velQ16 = 0;
+  _settled = true;
+  write(value);
 }
 
 void Meter::setTarget(float value) {
@@ -26,32 +131,250 @@ void Meter::setTarget(float value) {
     value = 1023.0f;
   if (value < 0.0f)
     value = 0.0f;
-  _targetVal = value;
+  int32_t target = (int32_t)(value * 65536.0f);
+
+  // Time this step if the probe is free and it is an ordinary step
+  int32_t delta = target - _targetQ16;
+  if (_probeDir == 0 && delta != 0 &&
+      abs(delta) <= (METER_PROBE_MAX_DELTA << 16)) {
+    _probeQ16 = target;
+    _probeStart = micros();
+    _probeDir = (delta > 0) ? 1 : -1; // Armed last; update() checks it first
+  }
+  _targetQ16 = target;
 }
 
 void Meter::update() {
-  unsigned long now = millis();
-  unsigned long dt = now - _lastUpdate;
+  // Never write the duty while a hardware fade still owns the channel
+  if (_fadeDuration > 0) {
+    if (millis() - _fadeStart < _fadeDuration)
+      return;
+    _fadeDuration = 0;
+  }
 
-  if (dt > 2) { // Update every few ms
-    _lastUpdate = now;
+  applyModeChanges();
+  int32_t target = currentTarget();
+  if (_drive == MeterDrive::HardwareFade) {
+    updateHardwareFade(target);
+    if (_fadeDuration == 0)
+      checkProbe((int32_t)_duty << 16);
+  } else {
+    updateSoftware(target);
+    checkProbe(_posQ16);
+  }
+}
 
-    // Ramping speed: units per millisecond
-    // 1024 / 2000ms = 0.512 units/ms.
-    float speed = 1.8f;
-    float maxStep = speed * (float)dt;
-    if (maxStep < 1.0f)
-      maxStep = 1.0f; // Minimum step
+void Meter::setReturn(ReturnMode mode, float maxSlewPerMs, uint16_t budgetMs) {
+  _returnMode = mode;
+  _returnMaxSlew = max(maxSlewPerMs, METER_SLEW_PER_MS);
+  _returnBudgetMs = budgetMs;
+}
 
-    if (abs(_currentVal - _targetVal) < maxStep) {
-      _currentVal = _targetVal;
-    } else {
-      if (_currentVal < _targetVal) {
-        _currentVal += maxStep;
+static float returnSlew(float delta, float maxSlew, uint16_t budgetMs) {
+  float slew = budgetMs > 0 ? delta / budgetMs : maxSlew;
+  return constrain(slew, METER_SLEW_PER_MS, maxSlew);
+}
+
+uint32_t Meter::returnTimeUs(float delta) const {
+  delta = fabsf(delta);
+  float ms = delta / returnSlew(delta, _returnMaxSlew, _returnBudgetMs);
+  return (uint32_t)(ms * 1000.0f) + METER_TICK_US / 2 + METER_RC_TAU_US;
+}
+
+void Meter::armWrap(unsigned long atMicros, float value) {
+  if (_wrapState == 2)
+    return; // Already on its way
+  _wrapQ16 = (int32_t)(constrain(value, 0.0f, 1023.0f) * 65536.0f);
+  _wrapAt = atMicros;
+  _wrapState = 1; // Armed last; update() checks it first
+}
+
+// The target for this tick: the frame's target, or the wrap value while a
+// pre-emptive return runs ahead of the frames. Starts wrap returns.
+int32_t Meter::currentTarget() {
+  int32_t target = _targetQ16;
+  int32_t shown = (_drive == MeterDrive::HardwareFade) ? ((int32_t)_duty << 16)
+                                                       : _posQ16;
+
+  if (_returnMode == ReturnMode::Preemptive && _wrapState != 0) {
+    long until = (long)(_wrapAt - micros());
+    if (_wrapState == 1 &&
+        until <= (long)returnTimeUs((shown - _wrapQ16) / 65536.0f)) {
+      _wrapState = 2;
+    }
+    if (_wrapState == 2) {
+      // Hold the wrap value until the frames have wrapped too
+      if (abs(target - _wrapQ16) < (METER_WRAP_MIN_DELTA << 16) ||
+          until < -METER_WRAP_TIMEOUT_US) {
+        _wrapState = 0;
       } else {
-        _currentVal -= maxStep;
+        target = _wrapQ16;
       }
+    } else if (until < -METER_WRAP_TIMEOUT_US) {
+      _wrapState = 0; // Missed it (mode change, stalled frames)
     }
-    ledcWrite(_channel, (int)_currentVal);
+  } else {
+    _wrapState = 0;
+  }
+
+  // A big backward jump is a wrap: go back at the return speed
+  if (_returnMode != ReturnMode::Normal &&
+      target < _lastTargetQ16 - (METER_WRAP_MIN_DELTA << 16)) {
+    float delta = (shown - target) / 65536.0f;
+    _returnSlew = returnSlew(delta, _returnMaxSlew, _returnBudgetMs);
   }
+  _lastTargetQ16 = target;
+  return target;
+}
+
+// Record how long the needle took to reach the probed target
+void Meter::checkProbe(int32_t shownQ16) {
+  int8_t dir = _probeDir;
+  if (dir == 0)
+    return;
+
+  unsigned long elapsed = micros() - _probeStart;
+  if (elapsed > METER_PROBE_TIMEOUT_US) {
+    _probeDir = 0;
+    return;
+  }
+  // Arrived once within half a PWM unit (or past it, when overshooting)
+  int32_t probe = _probeQ16;
+  if (dir > 0 ? shownQ16 < probe - 0x8000 : shownQ16 > probe + 0x8000)
+    return;
+
+  uint32_t sampleQ4 = (elapsed + METER_RC_TAU_US) << 4;
+  if (_latencyQ4 == 0)
+    _latencyQ4 = sampleQ4;
+  else
+    _latencyQ4 += ((int32_t)(sampleQ4 - _latencyQ4)) >> 3;
+  _probeDir = 0;
+}
+
+void Meter::updateHardwareFade(int32_t target) {
+  int duty = (target + 0x8000) >> 16; // Rounded, like the software ramp
+  if (duty == _duty)
+    return;
+
+  // Same slew rate as the software ramp, but the LEDC unit does the steps
+  int delta = abs(duty - _duty);
+  float slew = _returnSlew > 0 ? _returnSlew : METER_SLEW_PER_MS;
+  _returnSlew = 0;
+  int durationMs = (int)(delta / slew);
+  if (durationMs < 1)
+    durationMs = 1;
+
+  ledc_mode_t mode = (ledc_mode_t)(_channel / 8);
+  ledc_channel_t channel = (ledc_channel_t)(_channel % 8);
+  if (ledc_set_fade_time_and_start(mode, channel, duty, durationMs,
+                                   LEDC_FADE_NO_WAIT) == ESP_OK) {
+    _duty = duty;
+    _fadeStart = millis();
+    _fadeDuration = durationMs;
+  } else {
+    write(duty);
+  }
+}
+
+void Meter::updateSoftware(int32_t target) {
+  unsigned long now = micros();
+  unsigned long ticks = (now - _lastTick) / METER_TICK_US;
+  if (ticks == 0)
+    return;
+  _lastTick += ticks * METER_TICK_US;
+
+  if (_settled && target == _posQ16)
+    return; // Nothing to integrate and nothing to write
+  _settled = false;
+
+  if (ticks > METER_MAX_CATCHUP_TICKS)
+    ticks = METER_MAX_CATCHUP_TICKS;
+  while (ticks-- > 0 && !_settled) {
+    step(target);
+  }
+
+  int duty = (_posQ16 + 0x8000) >> 16;
+  if (duty > 1023)
+    duty = 1023;
+  if (duty < 0)
+    duty = 0;
+  if (duty != _duty)
+    write(duty);
+}
+
+// Advance the needle by one fixed tick
+void Meter::step(int32_t target) {
+  int32_t err = target - _posQ16;
+  int32_t absErr = abs(err);
+  int32_t dir = (err >= 0) ? 1 : -1;
+
+  // Wrap return: straight back at the return speed, whatever the profile
+  if (_returnSlew > 0) {
+    int32_t slew = Q16(_returnSlew);
+    if (absErr <= slew) {
+      _posQ16 = target;
+      _velQ16 = 0;
+      _returnSlew = 0;
+      _settled = true;
+    } else {
+      _posQ16 += dir * slew;
+    }
+    return;
+  }
+
+  switch (_profile) {
+  case MotionProfile::Linear:
+    if (absErr <= SLEW_Q16) {
+      _posQ16 = target;
+      _settled = true;
+    } else {
+      _posQ16 += dir * SLEW_Q16;
+    }
+    return;
+
+  case MotionProfile::SCurve: {
+    // Fastest speed from which we can still brake to a stop at the target
+    int32_t brake = isqrt64(2ULL * ACCEL_Q16 * (uint64_t)absErr);
+    int32_t want = dir * min(SLEW_Q16, brake);
+    if (_velQ16 < want)
+      _velQ16 = min(_velQ16 + ACCEL_Q16, want);
+    else
+      _velQ16 = max(_velQ16 - ACCEL_Q16, want);
+    _posQ16 += _velQ16;
+    if (absErr <= 0x8000 && abs(_velQ16) <= 2 * ACCEL_Q16) {
+      _posQ16 = target;
+      _velQ16 = 0;
+      _settled = true;
+    }
+    return;
+  }
+
+  case MotionProfile::Damped:
+  case MotionProfile::Vintage: {
+    bool damped = (_profile == MotionProfile::Damped);
+    int32_t k = damped ? DAMPED_K : VINTAGE_K;
+    int32_t c = damped ? DAMPED_C : VINTAGE_C;
+    int64_t accel = (int64_t)k * err - (int64_t)c * _velQ16;
+    _velQ16 += (int32_t)(accel >> 16);
+    _posQ16 += _velQ16;
+    if (absErr <= 0x4000 && abs(_velQ16) <= 0x200) {
+      _posQ16 = target;
+      _velQ16 = 0;
+      _settled = true;
+    }
+    return;
+  }
+  }
+}
+
+int Meter::getDuty() const {
+  if (_drive == MeterDrive::HardwareFade)
+    return ledc_get_duty((ledc_mode_t)(_channel / 8),
+                         (ledc_channel_t)(_channel % 8));
+  return _duty;
+}
+
+void Meter::write(int duty) {
+  _duty = duty;
+  ledcWrite(_channel, duty);
 }
@@ -1,6 +1,48 @@
 #pragma once
 #include <Arduino.h>
 
+// Ramping speed: PWM units per millisecond
+#define METER_SLEW_PER_MS 1.8f
+
+// Software motion is integrated in fixed steps so the trajectory does not
+// depend on how often loop() gets around to calling update()
+#define METER_TICK_US 1000
+#define METER_MAX_CATCHUP_TICKS 50 // Longer stalls are dropped, not replayed
+
+// 0.1uF smoothing cap across the meter with the ~3.3k calibration resistor
+// (see wiring.md): the needle current trails the PWM by about one R*C
+#define METER_RC_TAU_US 330
+
+// Latency probe: target steps up to this many PWM units are timed (larger
+// jumps are wraps or mode changes); give up on a step after the timeout
+#define METER_PROBE_MAX_DELTA 128
+#define METER_PROBE_TIMEOUT_US 2000000
+
+// A backward target jump bigger than this is a scale wrap (59->0, 23->0)
+#define METER_WRAP_MIN_DELTA 341
+#define METER_WRAP_TIMEOUT_US 1000000 // Give up holding a pre-emptive wrap
+
+// How the needle is moved towards its target
+enum class MeterDrive : uint8_t {
+  Software = 0,     // update() steps the duty from loop()
+  HardwareFade = 1, // LEDC fade unit ramps the duty, no CPU per step
+};
+
+// Needle trajectory used by the software drive
+enum class MotionProfile : uint8_t {
+  Linear = 0,  // Constant slew (original behaviour)
+  SCurve = 1,  // Acceleration limited, eases in and out
+  Damped = 2,  // Critically damped second order, no overshoot
+  Vintage = 3, // Under-damped ballistic, overshoots and settles
+};
+
+// What the needle does when its scale wraps back to zero
+enum class ReturnMode : uint8_t {
+  Normal = 0,     // Same motion as any other move (original behaviour)
+  Fast = 1,       // Straight back at the return speed once the scale wraps
+  Preemptive = 2, // Leave early so the needle reaches zero on the boundary
+};
+
 class Meter {
 public:
   Meter(int pin, int channel);
@@ -9,13 +51,77 @@ public:
   void setTarget(float value); // Smooth ramp target
   void update();             // Call frequently to update ramp
 
+  // Mode changes are picked up by the next update(), so they are safe to
+  // request from another task than the one running update().
+  // Returns false (and stays in Software) if the fade unit is unavailable.
+  bool setDrive(MeterDrive drive);
+  MeterDrive getDrive() const { return _requestedDrive; }
+
+  void setProfile(MotionProfile profile) { _requestedProfile = profile; }
+  MotionProfile getProfile() const { return _requestedProfile; }
+
+  // Time from a target change of `delta` PWM units until the needle shows
+  // it, for the requested drive/profile (includes tick and RC filter delay)
+  uint32_t estimateLatencyUs(float delta) const;
+
+  // Same, but measured on the live needle (moving average, 0 = no samples)
+  uint32_t getMeasuredLatencyUs() const { return _latencyQ4 >> 4; }
+
+  // Wrap returns go at delta / budgetMs, but no faster than maxSlewPerMs
+  // and no slower than the normal slew
+  void setReturn(ReturnMode mode, float maxSlewPerMs, uint16_t budgetMs);
+  uint32_t returnTimeUs(float delta) const;
+
+  // Pre-emptive mode: the scale wraps to `value` at micros() == atMicros.
+  // Safe to call every frame; the meter task starts the return on time.
+  void armWrap(unsigned long atMicros, float value);
+
+  // Live state for telemetry, safe to read from any task
+  int getDuty() const; // On the pin now (part way through a hardware fade)
+  float getTarget() const { return _targetQ16 / 65536.0f; }
+
 private:
   int _pin;
   int _channel;
   const int _freq = 5000;
   const int _resolution = 10;
 
-  float _currentVal = 0;
-  float _targetVal = 0;
-  unsigned long _lastUpdate = 0;
+  // Needle state in Q16 PWM units; velocity is per tick
+  volatile int32_t _targetQ16 = 0;
+  int32_t _posQ16 = 0;
+  int32_t _velQ16 = 0;
+  volatile int _duty = 0; // Last value written to the PWM
+  bool _settled = true;
+  unsigned long _lastTick = 0; // micros() of the last integrated tick
+
+  MeterDrive _drive = MeterDrive::Software;
+  MotionProfile _profile = MotionProfile::Linear;
+  volatile MeterDrive _requestedDrive = MeterDrive::Software;
+  volatile MotionProfile _requestedProfile = MotionProfile::Linear;
+  unsigned long _fadeStart = 0;    // millis() when the last fade started
+  unsigned long _fadeDuration = 0; // 0 when no fade is running
+
+  // setTarget() arms the probe, update() times when the needle gets there
+  volatile int32_t _probeQ16 = 0;
+  volatile unsigned long _probeStart = 0; // micros() when armed
+  volatile int8_t _probeDir = 0;          // 0 = idle, else direction
+  volatile uint32_t _latencyQ4 = 0;       // EWMA, 4 fractional bits
+
+  // Wrap return
+  volatile ReturnMode _returnMode = ReturnMode::Normal;
+  volatile float _returnMaxSlew = METER_SLEW_PER_MS;
+  volatile uint16_t _returnBudgetMs = 0;
+  float _returnSlew = 0;        // Speed of the return in progress, 0 = none
+  int32_t _lastTargetQ16 = 0;   // Target seen by the previous update()
+  volatile uint8_t _wrapState = 0; // 0 idle, 1 armed, 2 returning early
+  volatile unsigned long _wrapAt = 0;
+  volatile int32_t _wrapQ16 = 0;
+
+  void applyModeChanges();
+  int32_t currentTarget();
+  void updateSoftware(int32_t target);
+  void updateHardwareFade(int32_t target);
+  void step(int32_t target);
+  void checkProbe(int32_t shownQ16);
+  void write(int duty);
 };
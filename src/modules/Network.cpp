@@ -1,21 +1,109 @@
 #include "Network.h"
+#include "Commands.h"
+#include "ConfigJson.h"
 #include "GlobalState.h"
+#include "Meter.h"
+#include "FrameScheduler.h"
+#include "LightSchedule.h"
+#include "Lighting.h"
+#include "Preview.h"
+#include "Profiler.h"
+#include "Tasks.h"
+#include "Telemetry.h"
 #include "TimeManager.h"
+#include "WebAssets.h"
+#include <ArduinoJson.h>
+#include <AsyncJson.h>
 #include <Update.h>
 #include <ESPmDNS.h>
 
 #include <sys/time.h>
 
 extern TimeManager timeManager;
+extern TaskManager tasks;
+extern CommandQueue commands;
+extern FrameScheduler frames;
+extern Profiler perf;
+extern Telemetry telemetry;
+extern Preview preview;
+extern Lighting lighting;
+extern Meter meterH;
+extern Meter meterM;
+extern Meter meterS;
+
+const TZOption timezones[] = {{"UTC", "UTC0"},
+                              {"Eastern", "EST5EDT,M3.2.0,M11.1.0"},
+                              {"Central", "CST6CDT,M3.2.0,M11.1.0"},
+                              {"Mountain", "MST7MDT,M3.2.0,M11.1.0"},
+                              {"Arizona", "MST7"},
+                              {"Pacific", "PST8PDT,M3.2.0,M11.1.0"},
+                              {"Alaska", "AKST9AKDT,M3.2.0,M11.1.0"},
+                              {"Hawaii", "HST10"},
+                              {"London", "GMT0BST,M3.5.0/1,M10.5.0"},
+                              {"Paris", "CET-1CEST,M3.5.0,M10.5.0/3"},
+                              {"Tokyo", "JST-9"},
+                              {"Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3"}};
+const size_t timezoneCount = sizeof(timezones) / sizeof(timezones[0]);
 
 #define AP_SSID "MeterClock_Config"
+
+// Pages revalidate by ETag on every visit (and get a 304 back); assets they
+// link to have the ETag in their URL, so they can be cached for good
+#define WEB_CACHE_PAGE "no-cache"
+#define WEB_CACHE_ASSET "public, max-age=31536000, immutable"
+
+static const WebAsset *findAsset(const char *name) {
+  for (size_t i = 0; i < webAssetCount; i++) {
+    if (strcmp(webAssets[i].name, name) == 0)
+      return &webAssets[i];
+  }
+  return nullptr;
+}
+
+// Straight from flash, still gzipped (every browser accepts it)
+static void sendAsset(AsyncWebServerRequest *request, const WebAsset &asset) {
+  bool page = strcmp(asset.type, "text/html") == 0;
+  AsyncWebServerResponse *response;
+  if (request->hasHeader("If-None-Match") &&
+      request->header("If-None-Match") == asset.etag) {
+    response = request->beginResponse(304);
+  } else {
+    response =
+        request->beginResponse_P(200, asset.type, asset.data, asset.size);
+    response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", page ? WEB_CACHE_PAGE : WEB_CACHE_ASSET);
+  request->send(response);
+}
+static void sendJson(AsyncWebServerRequest *request, int code,
+                     const JsonDocument &doc) {
+  if (doc.overflowed()) {
+    request->send(500, "text/plain", "Response too large");
+    return;
+  }
+  String json;
+  serializeJson(doc, json);
+  request->send(code, "application/json", json);
+}
+
 #define DNS_PORT 53
 
 NetworkManager::NetworkManager(Config &config)
     : _server(80), _dnsServer(), _config(config), _isAP(false) {}
 
+void NetworkManager::testStation(bool on) {
+  if (on) {
+    Serial.println("[WiFi] Switching to AP_STA mode to test connection...");
+    WiFi.mode(WIFI_AP_STA);
+    WiFi.begin(_config.getSSID().c_str(), _config.getWifiPass().c_str());
+  } else {
+    WiFi.mode(WIFI_AP);
+  }
+}
+
+// Config is loaded by setup() before this
 void NetworkManager::begin() {
-  _config.begin(); // Ensure config is initialized
   connectWiFi();
 
   if (WiFi.status() != WL_CONNECTED) {
@@ -133,12 +221,6 @@ void NetworkManager::setupAP() {
   Serial.println("=========================================\n");
 }
 
-String NetworkManager::getWiFiScanHTML() {
-  // WiFi scanning disabled - causes watchdog timeout in AP mode
-  return "<p><strong>WiFi scanning is not available.</strong></p>"
-         "<p>Please manually enter your network SSID below.</p>";
-}
-
 void NetworkManager::setupRoutes() {
   _server.onNotFound([this](AsyncWebServerRequest *request) {
     Serial.print("[HTTP] 404 Not Found: ");
@@ -208,7 +290,7 @@ void NetworkManager::setupRoutes() {
     });
   }
 
-  _server.on("/", HTTP_GET, [this](AsyncWebServerRequest *request) {
+  _server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
     Serial.print("[HTTP] GET / from ");
     Serial.println(request->client()->remoteIP());
 
@@ -218,73 +300,25 @@ void NetworkManager::setupRoutes() {
       return;
     }
 
-    String html = "<html><head><meta name='viewport' "
-                  "content='width=device-width, initial-scale=1'>";
-    html += getCommonStyle();
-    html += "</head><body>";
-    html += "<h1>Meter Clock Dashboard</h1>";
-    html += "<h2 id='clock'>Loading time...</h2>";
-    html += "<a href='/settings/time' class='btn'>Time Settings</a>";
-    html += "<a href='/settings/led' class='btn'>LED Lighting</a>";
-    html += "<a href='/calibration' class='btn'>Meter Calibration</a>";
-    html += "<a href='/settings/system' class='btn'>Firmware</a>";
-    html += "<a href='/wifi' class='btn'>WiFi Configuration</a>";
-    html += "<script>setInterval(function() { fetch('/api/time').then(response "
-            "=> response.text()).then(time => "
-            "document.getElementById('clock').innerText = time).catch(err => "
-            "console.error(err)); }, 1000);</script>";
-    html += "</body></html>";
-    request->send(200, "text/html", html);
+    sendAsset(request, *findAsset("index.html"));
   });
 
-  _server.on("/wifi", HTTP_GET, [this](AsyncWebServerRequest *request) {
-    String html = "<html><head><meta name='viewport' "
-                  "content='width=device-width, initial-scale=1'>";
-    html += getCommonStyle();
-    html += "<script>";
-    html += "function togglePassword() {";
-    html += "  var x = document.getElementById('password');";
-    html += "  var icon = document.getElementById('toggleIcon');";
-    html += "  if (x.type === 'password') {";
-    html += "    x.type = 'text';";
-    html += "    icon.innerHTML = 'Hide';";
-    html += "  } else {";
-    html += "    x.type = 'password';";
-    html += "    icon.innerHTML = 'Show';";
-    html += "  }";
-    html += "}";
-    html += "</script>";
-    html += "</head><body>";
-    html += "<h1>WiFi Configuration</h1>";
-    html += getWiFiScanHTML();
-    html += "<h3>Connect to Network</h3>";
-    html += "<form action='/save_wifi' method='POST'>";
-    html += "<input type='text' name='ssid' placeholder='Network Name (SSID)' "
-            "required><br>";
-    html += "<div class='password-container'>";
-    html += "<input type='password' id='password' name='pass' "
-            "placeholder='Password (leave blank if none)'>";
-    html += "<span class='toggle-password' id='toggleIcon' "
-            "onclick='togglePassword()'>Show</span>";
-    html += "</div><br>";
-    html += "<input type='submit' value='Save & Connect'>";
-    html += "</form>";
-    html += "<h3>Clear Saved WiFi</h3>";
-    html += "<form action='/clear_wifi' method='POST'>";
-    html +=
-        "<input type='submit' value='Clear WiFi Credentials' class='danger'>";
-    html += "</form>";
-    html += "<a href='/'>&larr; Back to Dashboard</a>";
-    html += "</body></html>";
-    request->send(200, "text/html", html);
-  });
+  // Styles and scripts, at their file name
+  for (size_t i = 0; i < webAssetCount; i++) {
+    if (strcmp(webAssets[i].type, "text/html") != 0)
+      serveAsset(("/" + String(webAssets[i].name)).c_str(), webAssets[i].name);
+  }
+
+  serveAsset("/wifi", "wifi.html");
 
   _server.on("/save_wifi", HTTP_POST, [this](AsyncWebServerRequest *request) {
     String ssid = request->arg("ssid");
     String pass = request->arg("pass");
     if (ssid.length() > 0) {
       Serial.println("[WiFi] Saving credentials: " + ssid);
+      Config::Transaction tx(_config);
       _config.saveWiFi(ssid, pass);
+      tx.commit();
 
       // Send response with auto-refresh to status page
       String html = "<html><head><meta name='viewport' "
@@ -299,10 +333,8 @@ void NetworkManager::setupRoutes() {
       html += "</body></html>";
       request->send(200, "text/html", html);
 
-      // Switch to AP_STA mode and try to connect (keeps AP running)
-      Serial.println("[WiFi] Switching to AP_STA mode to test connection...");
-      WiFi.mode(WIFI_AP_STA);
-      WiFi.begin(ssid.c_str(), pass.c_str());
+      // Try to connect, keeping the AP running (next frame)
+      commands.push(CommandType::WiFiTest, 1);
     } else {
       request->send(400, "text/html",
                     "<h2>Error: SSID required</h2><a href='/wifi'>Back</a>");
@@ -332,9 +364,8 @@ void NetworkManager::setupRoutes() {
       html += "</body></html>";
       request->send(200, "text/html", html);
 
-      delay(100);
       Serial.println("[WiFi] Connection successful! Restarting...");
-      ESP.restart();
+      commands.push(CommandType::Restart, 100); // Let response send
     } else {
       html += "<h2 class='error'>Connection Failed</h2>";
       html += "<p>Could not connect to <strong>" + _config.getSSID() +
@@ -345,8 +376,8 @@ void NetworkManager::setupRoutes() {
       html += "</body></html>";
       request->send(200, "text/html", html);
 
-      // Go back to AP-only mode
-      WiFi.mode(WIFI_AP);
+      // Go back to AP-only mode (next frame)
+      commands.push(CommandType::WiFiTest, 0);
     }
   });
 
@@ -368,135 +399,17 @@ void NetworkManager::setupRoutes() {
     html += "</body></html>";
     request->send(200, "text/html", html);
 
-    delay(100); // Let response send
     Serial.println("[WiFi] Restarting...");
-    ESP.restart();
+    commands.push(CommandType::Restart, 100); // Let response send
   });
 
   // =================================================================================
   //  TIME & DISPLAY SETTINGS
   // =================================================================================
-  _server.on(
-      "/settings/time", HTTP_GET, [this](AsyncWebServerRequest *request) {
-        String tz = _config.getTimezone();
-        String tz2 = _config.getTimezone2();
-        String ntp = _config.getNTP();
-        bool h12 = _config.get12H();
-        bool useNTP = _config.getUseNTP();
-        bool smoothSec = _config.getSmoothSeconds();
-
-        String html = "<html><head><meta name='viewport' "
-                      "content='width=device-width, initial-scale=1'>";
-        html += getCommonStyle();
-        html += "<script>";
-        html += "function toggleTimeSource() {";
-        html += "  var useNTP = "
-                "document.querySelector('input[name=\"useNTP\"]:checked')."
-                "value === '1';";
-        html += "  document.getElementById('manualTimeDiv').style.display = "
-                "useNTP ? 'none' : 'block';";
-        html += "}";
-        html += "function syncBrowserTime() {";
-        html += "  var now = new Date();";
-        html += "  var offset = now.getTimezoneOffset() * 60000;";
-        html += "  var localIso = new Date(now - "
-                "offset).toISOString().slice(0, 16);";
-        html += "  document.getElementById('manualTime').value = localIso;";
-        html += "}";
-        html += "function saveTime(event) {";
-        html += "  event.preventDefault();";
-        html += "  fetch('/save_time', { method: 'POST', body: new "
-                "FormData(event.target) })";
-        html += "    .then(r => { if(r.ok) alert('Time Settings Saved!'); else "
-                "alert('Error!'); });";
-        html += "  return false;";
-        html += "}";
-        html += "</script></head><body>";
-
-        html += "<h1>Time Settings</h1>";
-        html += "<form onsubmit='return saveTime(event)'>";
-
-        // Timezone 1
-        html += "<label>Primary Timezone:</label><select name='timezone'>";
-        struct TZOption {
-          const char *name;
-          const char *posix;
-        };
-        TZOption timezones[] = {{"UTC", "UTC0"},
-                                {"Eastern", "EST5EDT,M3.2.0,M11.1.0"},
-                                {"Central", "CST6CDT,M3.2.0,M11.1.0"},
-                                {"Mountain", "MST7MDT,M3.2.0,M11.1.0"},
-                                {"Arizona", "MST7"},
-                                {"Pacific", "PST8PDT,M3.2.0,M11.1.0"},
-                                {"Alaska", "AKST9AKDT,M3.2.0,M11.1.0"},
-                                {"Hawaii", "HST10"},
-                                {"London", "GMT0BST,M3.5.0/1,M10.5.0"},
-                                {"Paris", "CET-1CEST,M3.5.0,M10.5.0/3"},
-                                {"Tokyo", "JST-9"},
-                                {"Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3"}};
-        for (auto &t : timezones) {
-          html += "<option value='" + String(t.posix) + "'" +
-                  (tz == t.posix ? " selected" : "") + ">" + t.name +
-                  "</option>";
-        }
-        html += "</select>";
-
-        // Timezone 2
-        html += "<label>Secondary Timezone (GPIO Switch):</label><select "
-                "name='timezone2'>";
-        for (auto &t : timezones) {
-          html += "<option value='" + String(t.posix) + "'" +
-                  (tz2 == t.posix ? " selected" : "") + ">" + t.name +
-                  "</option>";
-        }
-        html += "</select>";
-
-        // NTP Server
-        html +=
-            "<label>NTP Server:</label><input type='text' name='ntp' value='" +
-            ntp + "'>";
-
-        // Time Source
-        html += "<label>Time Source:</label><div class='radio-group'>";
-        html += "<label><input type='radio' name='useNTP' value='1'" +
-                String(useNTP ? " checked" : "") +
-                " onchange='toggleTimeSource()'> Automatic (NTP)</label>";
-        html += "<label><input type='radio' name='useNTP' value='0'" +
-                String(!useNTP ? " checked" : "") +
-                " onchange='toggleTimeSource()'> Manual</label>";
-        html += "</div>";
-
-        // Manual Time
-        html += "<div id='manualTimeDiv' style='display:" +
-                String(useNTP ? "none" : "block") + "'>";
-        html += "<label>Set Date & Time:</label><input type='datetime-local' "
-                "id='manualTime' name='manualTime'>";
-        html += "<button type='button' onclick='syncBrowserTime()' "
-                "style='margin-top:5px;'>Sync Browser Time</button></div>";
-
-        // Hour Format
-        html += "<label>Hour Format:</label><div class='radio-group'>";
-        html += "<label><input type='radio' name='h12' value='0'" +
-                String(!h12 ? " checked" : "") + "> 24-Hour</label>";
-        html += "<label><input type='radio' name='h12' value='1'" +
-                String(h12 ? " checked" : "") + "> 12-Hour</label>";
-        html += "</div>";
-
-        // Second Hand Movement
-        html += "<label>Second Hand Movement:</label><div class='radio-group'>";
-        html += "<label><input type='radio' name='smoothSec' value='0'" +
-                String(!smoothSec ? " checked" : "") + "> Ticking</label>";
-        html += "<label><input type='radio' name='smoothSec' value='1'" +
-                String(smoothSec ? " checked" : "") + "> Sweeping</label>";
-        html += "</div>";
-
-        html += "<input type='submit' value='Save Time Settings'>";
-        html += "</form>";
-        html += "<a href='/'>&larr; Back to Dashboard</a></body></html>";
-        request->send(200, "text/html", html);
-      });
+  serveAsset("/settings/time", "time.html");
 
   _server.on("/save_time", HTTP_POST, [this](AsyncWebServerRequest *request) {
+    Config::Transaction tx(_config);
     if (request->hasArg("timezone"))
       _config.saveTimezone(request->arg("timezone"));
     if (request->hasArg("timezone2"))
@@ -507,13 +420,40 @@ void NetworkManager::setupRoutes() {
       _config.save12H(request->arg("h12") == "1");
     if (request->hasArg("smoothSec"))
       _config.saveSmoothSeconds(request->arg("smoothSec") == "1");
-
-    if (request->hasArg("useNTP")) {
-      bool use = request->arg("useNTP") == "1";
-      _config.saveUseNTP(use);
-      timeManager.setUseNTP(use);
+    if (request->hasArg("meterDrive"))
+      _config.saveMeterDrive(request->arg("meterDrive") == "1" ? 1 : 0);
+    if (request->hasArg("motionProfile")) {
+      long profile = request->arg("motionProfile").toInt();
+      _config.saveMotionProfile(constrain(profile, 0, 3));
+    }
+    const char *latNames[] = {"latH", "latM", "latS"};
+    for (uint8_t i = 0; i < 3; i++) {
+      if (request->hasArg(latNames[i])) {
+        float ms = request->arg(latNames[i]).toFloat();
+        _config.saveMeterLatencyUs(i, (uint32_t)(constrain(ms, 0.0f, 1000.0f) *
+                                                 1000.0f));
+      }
+    }
+    if (request->hasArg("returnMode")) {
+      long mode = request->arg("returnMode").toInt();
+      _config.saveReturnMode(constrain(mode, 0, 2));
+    }
+    if (request->hasArg("returnSlew")) {
+      float slew = request->arg("returnSlew").toFloat();
+      _config.saveReturnSlew(constrain(slew, METER_SLEW_PER_MS, 100.0f));
+    }
+    const char *retNames[] = {"retH", "retM", "retS"};
+    for (uint8_t i = 0; i < 3; i++) {
+      if (request->hasArg(retNames[i])) {
+        long ms = request->arg(retNames[i]).toInt();
+        _config.saveReturnBudgetMs(i, constrain(ms, 0, 2000));
+      }
     }
 
+    // The clock itself is changed by the frame loop's Time listener
+    if (request->hasArg("useNTP"))
+      _config.saveUseNTP(request->arg("useNTP") == "1");
+
     if (request->hasArg("manualTime") &&
         request->arg("manualTime").length() > 0) {
       String dtStr = request->arg("manualTime");
@@ -526,12 +466,7 @@ void NetworkManager::setupRoutes() {
         timeinfo.tm_hour = h;
         timeinfo.tm_min = m;
         timeinfo.tm_sec = 0;
-        time_t ts = mktime(&timeinfo);
-        _config.saveManualTime(ts);
-        if (!_config.getUseNTP()) {
-          struct timeval tv = {ts, 0};
-          settimeofday(&tv, NULL);
-        }
+        _config.saveManualTime(mktime(&timeinfo));
       }
     }
     request->send(200, "text/plain", "OK");
@@ -540,98 +475,33 @@ void NetworkManager::setupRoutes() {
   // =================================================================================
   //  LED SETTINGS
   // =================================================================================
-  _server.on("/settings/led", HTTP_GET, [this](AsyncWebServerRequest *request) {
-    uint32_t dayColor = _config.getDayColor();
-    uint32_t nightColor = _config.getNightColor();
-    uint8_t dayBright = _config.getDayBrightness();
-    uint8_t nightBright = _config.getNightBrightness();
-    uint8_t nightStart = _config.getNightStart();
-    uint8_t nightEnd = _config.getNightEnd();
-
-    String html = "<html><head><meta name='viewport' "
-                  "content='width=device-width, initial-scale=1'>";
-    html += getCommonStyle();
-    html += "<script>";
-    html += "function updateSlider(id, valId) {";
-    html += "  var val = document.getElementById(id).value;";
-    html += "  document.getElementById(valId).innerText = Math.round(val * 100 "
-            "/ 255) + '%';";
-    html += "}";
-    html += "function saveLed(event) {";
-    html += "  event.preventDefault();";
-    html += "  fetch('/save_led', { method: 'POST', body: new "
-            "FormData(event.target) })";
-    html += "    .then(r => { if(r.ok) alert('LED Settings Saved!'); else "
-            "alert('Error!'); });";
-    html += "  return false;";
-    html += "}";
-    html += "</script></head><body>";
-
-    html += "<h1>LED Lighting</h1>";
-    html += "<form onsubmit='return saveLed(event)'>";
-
-    // Day
-    char buf[10];
-    sprintf(buf, "#%06X", dayColor);
-    html +=
-        "<label>Day Color:</label><input type='color' name='dayColor' value='" +
-        String(buf) + "'>";
-
-    html += "<label>Day Brightness:</label><div class='slider-container'>";
-    html += "<input type='range' id='db' name='dayBright' min='0' max='255' "
-            "value='" +
-            String(dayBright) + "' oninput='updateSlider(\"db\", \"dbv\")'>";
-    html += "<span class='slider-value' id='dbv'>" +
-            String(dayBright * 100 / 255) + "%</span></div>";
-
-    // Night
-    sprintf(buf, "#%06X", nightColor);
-    html += "<label>Night Color:</label><input type='color' name='nightColor' "
-            "value='" +
-            String(buf) + "'>";
-
-    html += "<label>Night Brightness:</label><div class='slider-container'>";
-    html += "<input type='range' id='nb' name='nightBright' min='0' max='255' "
-            "value='" +
-            String(nightBright) + "' oninput='updateSlider(\"nb\", \"nbv\")'>";
-    html += "<span class='slider-value' id='nbv'>" +
-            String(nightBright * 100 / 255) +
-            "%</span></div>"; // Fixed % calculation
-
-    // Schedule
-    char tBuf[6];
-    sprintf(tBuf, "%02d:%02d", nightStart, _config.getNightStartMinute());
-    html += "<label>Night Start (CST):</label><input type='time' "
-            "name='nightStart' value='" +
-            String(tBuf) + "'>";
-
-    sprintf(tBuf, "%02d:%02d", nightEnd, _config.getNightEndMinute());
-    html += "<label>Night End (CST):</label><input type='time' name='nightEnd' "
-            "value='" +
-            String(tBuf) + "'>";
-
-    html += "<div class='info'>Night mode activates between these times.</div>";
-    html += "<input type='submit' value='Save LED Settings'>";
-    html += "</form>";
-    html += "<a href='/'>&larr; Back to Dashboard</a></body></html>";
-    request->send(200, "text/html", html);
-  });
+  serveAsset("/settings/led", "led.html");
 
+  // Day/night fields are still accepted from older pages and clients; they
+  // replace the schedule with the equivalent pair of keyframes
   _server.on("/save_led", HTTP_POST, [this](AsyncWebServerRequest *request) {
+    Config::Transaction tx(_config);
+    bool dayNight = false;
     if (request->hasArg("dayColor")) {
       String c = request->arg("dayColor");
       c.replace("#", "");
       _config.saveDayColor(strtoul(c.c_str(), NULL, 16));
+      dayNight = true;
     }
     if (request->hasArg("nightColor")) {
       String c = request->arg("nightColor");
       c.replace("#", "");
       _config.saveNightColor(strtoul(c.c_str(), NULL, 16));
+      dayNight = true;
     }
-    if (request->hasArg("dayBright"))
+    if (request->hasArg("dayBright")) {
       _config.saveDayBrightness(request->arg("dayBright").toInt());
-    if (request->hasArg("nightBright"))
+      dayNight = true;
+    }
+    if (request->hasArg("nightBright")) {
       _config.saveNightBrightness(request->arg("nightBright").toInt());
+      dayNight = true;
+    }
 
     if (request->hasArg("nightStart")) {
       String t = request->arg("nightStart");
@@ -639,6 +509,7 @@ void NetworkManager::setupRoutes() {
       if (sep > 0) {
         _config.saveNightStart(t.substring(0, sep).toInt());
         _config.saveNightStartMinute(t.substring(sep + 1).toInt());
+        dayNight = true;
       }
     }
     if (request->hasArg("nightEnd")) {
@@ -647,208 +518,190 @@ void NetworkManager::setupRoutes() {
       if (sep > 0) {
         _config.saveNightEnd(t.substring(0, sep).toInt());
         _config.saveNightEndMinute(t.substring(sep + 1).toInt());
+        dayNight = true;
       }
     }
+    if (request->hasArg("fadeSec")) {
+      _config.saveLightFadeSec(
+          constrain(request->arg("fadeSec").toInt(), 0, 3600));
+      dayNight = true;
+    }
+    if (dayNight) {
+      _config.saveLightSchedule(_config.dayNightSchedule());
+    }
+
+    if (request->hasArg("ledCount"))
+      _config.saveLedCount(
+          constrain(request->arg("ledCount").toInt(), 1, LED_MAX_COUNT));
     request->send(200, "text/plain", "OK");
   });
 
+  // API: Lighting schedule, keyframes sorted by time
+  _server.on("/api/led/schedule", HTTP_GET,
+             [this](AsyncWebServerRequest *request) {
+               const LightSchedulePoints &s = _config.getLightSchedule();
+               String json = "{\"keys\":[";
+               for (uint8_t i = 0; i < s.count; i++) {
+                 const LightKeyframe &k = s.keys[i];
+                 char buf[80];
+                 snprintf(buf, sizeof(buf),
+                          "%s{\"t\":\"%02u:%02u\",\"c\":\"#%06x\",\"b\":%u,"
+                          "\"f\":%u}",
+                          i ? "," : "", k.minute / 60, k.minute % 60,
+                          (unsigned)(k.color & 0xFFFFFF), k.brightness,
+                          k.fadeSec);
+                 json += buf;
+               }
+               json += "]}";
+               request->send(200, "application/json", json);
+             });
+
+  // Save the whole schedule: n=<count>, then t<i>=HH:MM, c<i>=#RRGGBB,
+  // b<i>=0-255 and f<i>=fade seconds for each keyframe
+  _server.on(
+      "/api/led/schedule", HTTP_POST, [this](AsyncWebServerRequest *request) {
+        LightSchedulePoints s;
+        memset(&s, 0, sizeof(s));
+        int n = request->hasArg("n") ? request->arg("n").toInt() : 0;
+        if (n < 1 || n > LIGHT_MAX_KEYFRAMES) {
+          request->send(400, "text/plain", "Bad keyframe count");
+          return;
+        }
+        for (int i = 0; i < n; i++) {
+          String idx = String(i);
+          String t = request->arg(("t" + idx).c_str());
+          String c = request->arg(("c" + idx).c_str());
+          int sep = t.indexOf(':');
+          if (sep <= 0 || c.length() == 0) {
+            request->send(400, "text/plain", "Bad keyframe " + idx);
+            return;
+          }
+          int minute = t.substring(0, sep).toInt() * 60 +
+                       t.substring(sep + 1).toInt();
+          if (minute < 0 || minute >= LIGHT_MINUTES_PER_DAY) {
+            request->send(400, "text/plain", "Bad time " + t);
+            return;
+          }
+          for (int j = 0; j < i; j++) {
+            if (s.keys[j].minute == minute) {
+              request->send(400, "text/plain", "Duplicate time " + t);
+              return;
+            }
+          }
+          c.replace("#", "");
+          LightKeyframe &k = s.keys[i];
+          k.minute = minute;
+          k.color = strtoul(c.c_str(), NULL, 16) & 0xFFFFFF;
+          k.brightness =
+              constrain(request->arg(("b" + idx).c_str()).toInt(), 0, 255);
+          k.fadeSec =
+              constrain(request->arg(("f" + idx).c_str()).toInt(), 0, 3600);
+        }
+        s.count = n;
+
+        // Stored sorted, so the API and the editor list them in order
+        ScheduleTable sorted;
+        sorted.build(s);
+        for (uint8_t i = 0; i < s.count; i++)
+          s.keys[i] = sorted.key(i);
+
+        _config.saveLightSchedule(s);
+        request->send(200, "text/plain", "OK");
+      });
+
   // =================================================================================
   //  SYSTEM SETTINGS
   // =================================================================================
-  _server.on(
-      "/settings/system", HTTP_GET, [this](AsyncWebServerRequest *request) {
-        String html = "<html><head><meta name='viewport' "
-                      "content='width=device-width, initial-scale=1'>";
-        html += getCommonStyle();
-        html += "<script>";
-        html += "function uploadFw() {";
-        html += "  var file = document.getElementById('fwFile').files[0];";
-        html += "  if(!file) { alert('Select a file!'); return; }";
-        html += "  var fd = new FormData(); fd.append('update', file);";
-        html += "  var xhr = new XMLHttpRequest();";
-        html += "  xhr.upload.addEventListener('progress', function(e) {";
-        html += "    if(e.lengthComputable) {";
-        html += "      var p = Math.round((e.loaded/e.total)*100);";
-        html +=
-            "      document.getElementById('progress').style.display='block';";
-        html += "      document.getElementById('pct').innerText = p;";
-        html += "      if(p >= 100) {";
-        html += "        document.getElementById('progress').innerHTML "
-                "= '<span style=\"color:green\">Success! Rebooting...</span>';";
-        html += "        setTimeout(function(){ window.location.href='/'; }, "
-                "5000);";
-        html += "      }";
-        html += "    }";
-        html += "  }, false);";
-        html += "  xhr.open('POST', '/update'); xhr.send(fd);";
-        html += "}";
-        html += "</script></head><body>";
-
-        html += "<h1>Firmware</h1>";
-        html += "<div class='card'><h3>Current Firmware</h3>";
-        html += "<p><strong>Build Date:</strong> " + String(__DATE__) + "</p>";
-        html += "<p><strong>Build Time:</strong> " + String(__TIME__) + "</p>";
-        html += "</div>";
-        html += "<div class='card'><h3>Firmware Update</h3>";
-        html += "<input type='file' id='fwFile' accept='.bin'>";
-        html += "<button onclick='uploadFw()' style='background-color:#f44336; "
-                "margin-top:10px;'>Upload Firmware</button>";
-        html +=
-            "<div id='progress' style='display:none; margin-top:15px; "
-            "font-weight:bold;'>Uploading... <span id='pct'>0</span>%</div>";
-        html += "</div>";
-
-        html += "<a href='/'>&larr; Back to Dashboard</a></body></html>";
-        request->send(200, "text/html", html);
-      });
+  serveAsset("/settings/system", "system.html");
 
-  _server.on("/calibration", HTTP_GET, [this](AsyncWebServerRequest *request) {
-    String html = "<html><head><meta name='viewport' "
-                  "content='width=device-width, initial-scale=1'>";
-    html += getCommonStyle();
-    html += "<script>";
-    html += "function saveCal(event) {";
-    html += "  event.preventDefault();";
-    html += "  var form = event.target;";
-    html += "  var data = new URLSearchParams(new FormData(form));";
-    // Also send to save endpoint
-    html += "  fetch(form.action, { method: form.method, body: data })";
-    html += "    .then(r => {";
-    html += "      if(r.ok) {";
-    html += "        alert('Saved!');";
-    html += "        var cb = document.getElementById('calMode');";
-    html += "        if(cb.checked) { cb.checked = false; toggleCalMode(cb); }";
-    html += "      } else { alert('Error: ' + r.statusText); }";
-    html += "    })";
-    html += "    .catch(e => alert('Error: ' + e));";
-    html += "  return false;";
-    html += "}";
-
-    html += "function toggleCalMode(cb) {";
-    html += "  var fd = new FormData();";
-    html += "  fd.append('active', cb.checked ? '1' : '0');";
-    html += "  fetch('/api/calibration/mode', { method: 'POST', body: fd });";
-    html += "  document.getElementById('calControls').style.opacity = "
-            "cb.checked ? '1' : '0.5';";
-    html += "}";
-
-    html += "function previewCal(idx, val) {";
-    html += "  if(!document.getElementById('calMode').checked) return;";
-    html += "  var fd = new FormData();";
-    html += "  fd.append('idx', idx);";
-    html += "  fd.append('val', val);";
-    html +=
-        "  fetch('/api/calibration/preview', { method: 'POST', body: fd });";
-    html += "}";
-    html += "</script>";
-    html += "</head><body>";
-    html += "<h1>Meter Calibration</h1>";
-
-    html += "<div class='card'>";
-    html += "<label class='switch'><input type='checkbox' id='calMode' "
-            "onchange='toggleCalMode(this)' " +
-            String(g_isCalibrationMode ? "checked" : "") +
-            "> Enable Calibration Mode</label>";
-    html += "<p class='small'>Enable this to stop the clock and set meters to "
-            "exact values.</p>";
-    html += "</div>";
-
-    html += "<form action='/save_calibration' method='POST' id='calControls' "
-            "onsubmit='return saveCal(event)'>";
-
-    // Helper macro for inputs
-    auto addInput = [&](String label, String name, int val, int idx) {
-      String s = "<div class='col'><label>" + label + "</label>";
-      s += "<input type='number' name='" + name + "' value='" + String(val) +
-           "' ";
-      s += "onfocus='previewCal(" + String(idx) + ", this.value)' ";
-      s += "oninput='previewCal(" + String(idx) + ", this.value)'>";
-      s += "</div>";
-      return s;
-    };
-
-    html += "<h3>Hour Meter</h3><div class='row'>";
-    html += addInput("Min (0)", "calHMin", _config.getCalHMin(), 0);
-    html += addInput("Mid (6/12)", "calHMid", _config.getCalHMid(), 0);
-    html += addInput("Max (12/24)", "calHMax", _config.getCalHMax(), 0);
-    html += "</div>";
-
-    html += "<h3>Minute Meter</h3><div class='row'>";
-    html += addInput("Min (0)", "calMMin", _config.getCalMMin(), 1);
-    html += addInput("Mid (30)", "calMMid", _config.getCalMMid(), 1);
-    html += addInput("Max (60)", "calMMax", _config.getCalMMax(), 1);
-    html += "</div>";
-
-    html += "<h3>Second Meter</h3><div class='row'>";
-    html += addInput("Min (0)", "calSMin", _config.getCalSMin(), 2);
-    html += addInput("Mid (30)", "calSMid", _config.getCalSMid(), 2);
-    html += addInput("Max (60)", "calSMax", _config.getCalSMax(), 2);
-    html += "</div>";
-
-    html += "<br><input type='submit' value='Save Calibration'>";
-    html += "</form>";
-    html += "<a href='/'>&larr; Back to Dashboard</a>";
-    html += "</body></html>";
-    request->send(200, "text/html", html);
-  });
+  serveAsset("/calibration", "calibration.html");
 
-  _server.on("/save_calibration", HTTP_POST,
+  // API: Full calibration point set
+  _server.on("/api/calibration", HTTP_GET,
              [this](AsyncWebServerRequest *request) {
-               if (request->hasArg("calHMin"))
-                 _config.saveCalHMin(request->arg("calHMin").toInt());
-               if (request->hasArg("calHMid"))
-                 _config.saveCalHMid(request->arg("calHMid").toInt());
-               if (request->hasArg("calHMax"))
-                 _config.saveCalHMax(request->arg("calHMax").toInt());
-
-               if (request->hasArg("calMMin"))
-                 _config.saveCalMMin(request->arg("calMMin").toInt());
-               if (request->hasArg("calMMid"))
-                 _config.saveCalMMid(request->arg("calMMid").toInt());
-               if (request->hasArg("calMMax"))
-                 _config.saveCalMMax(request->arg("calMMax").toInt());
-
-               if (request->hasArg("calSMin"))
-                 _config.saveCalSMin(request->arg("calSMin").toInt());
-               if (request->hasArg("calSMid"))
-                 _config.saveCalSMid(request->arg("calSMid").toInt());
-               if (request->hasArg("calSMax"))
-                 _config.saveCalSMax(request->arg("calSMax").toInt());
-
-               Serial.println("Calibration Saved"); // Debug
-               request->send(200, "text/plain", "OK");
+               String json = "{\"active\":";
+               json += g_calibration.read().active ? "true" : "false";
+               json += ",\"h12\":";
+               json += _config.get12H() ? "true" : "false";
+               const char *keys = "hms";
+               for (uint8_t m = 0; m < 3; m++) {
+                 json += ",\"";
+                 json += keys[m];
+                 json += "\":[";
+                 const uint16_t *pts = _config.getCalPoints(m);
+                 for (uint8_t i = 0; i < _config.getCalCount(m); i++) {
+                   if (i > 0)
+                     json += ",";
+                   json += String(pts[i]);
+                 }
+                 json += "]";
+               }
+               json += "}";
+               request->send(200, "application/json", json);
              });
 
+  // Save all meters in one request: hn=<count>, h0..h<n-1>, same for m/s
+  _server.on(
+      "/save_calibration", HTTP_POST, [this](AsyncWebServerRequest *request) {
+        CalibrationPoints cal = _config.getCalibration();
+        const char *keys = "hms";
+
+        for (uint8_t m = 0; m < 3; m++) {
+          String countKey = String(keys[m]) + "n";
+          if (!request->hasArg(countKey.c_str()))
+            continue;
+
+          int n = request->arg(countKey.c_str()).toInt();
+          if (n < 2 || n > CalibrationPoints::maxPoints(m)) {
+            request->send(400, "text/plain", "Bad point count");
+            return;
+          }
+          for (int i = 0; i < n; i++) {
+            String key = String(keys[m]) + String(i);
+            if (!request->hasArg(key.c_str())) {
+              request->send(400, "text/plain", "Missing " + key);
+              return;
+            }
+            long val = request->arg(key.c_str()).toInt();
+            cal.points(m)[i] = constrain(val, 0, 1023);
+          }
+          cal.count[m] = n;
+        }
+
+        _config.saveCalibration(cal);
+        Serial.println("Calibration Saved"); // Debug
+        request->send(200, "text/plain", "OK");
+      });
+
   // API: Calibration Mode Toggle
   _server.on(
       "/api/calibration/mode", HTTP_POST, [](AsyncWebServerRequest *request) {
+        bool active = g_calibration.read().active;
         if (request->hasArg("active")) {
-          bool active = (request->arg("active") == "1");
-          g_isCalibrationMode = active;
+          active = (request->arg("active") == "1");
           Serial.print("Calibration Mode Toggled: ");
           Serial.println(active ? "ON" : "OFF");
-
-          // Reset overrides when mode changes
-          g_calOverrideValues[0] = -1;
-          g_calOverrideValues[1] = -1;
-          g_calOverrideValues[2] = -1;
+          if (!commands.push(CommandType::CalibrationMode, active)) {
+            request->send(503, "text/plain", "Busy, try again");
+            return;
+          }
         }
-        request->send(200, "text/plain", g_isCalibrationMode ? "1" : "0");
+        // As it will be from the next frame
+        request->send(200, "text/plain", active ? "1" : "0");
       });
 
-  // API: Calibration Preview
+  // API: Calibration Preview (the page uses /ws/preview, see Preview.h)
   _server.on("/api/calibration/preview", HTTP_POST,
              [](AsyncWebServerRequest *request) {
-               if (g_isCalibrationMode && request->hasArg("idx") &&
-                   request->hasArg("val")) {
+               // Ignored by the frame loop unless calibration mode is on
+               if (request->hasArg("idx") && request->hasArg("val")) {
                  int idx = request->arg("idx").toInt();
-                 int val = request->arg("val").toInt();
-                 if (idx >= 0 && idx <= 2) {
-                   g_calOverrideValues[idx] = val;
-                 }
+                 if (idx >= 0 && idx <= 2)
+                   preview.setCalibration(idx, request->arg("val").toInt());
                }
                request->send(200, "text/plain", "OK");
              });
+  preview.begin(_server);
 
   // OTA Update Handler
   _server.on(
@@ -860,8 +713,8 @@ void NetworkManager::setupRoutes() {
         response->addHeader("Connection", "close");
         request->send(response);
         if (shouldReboot) {
-          delay(2000); // Increased to 2s to ensure client gets 200 OK
-          ESP.restart();
+          // 2s to ensure client gets 200 OK
+          commands.push(CommandType::Restart, 2000);
         }
       },
       [](AsyncWebServerRequest *request, String filename, size_t index,
@@ -894,12 +747,193 @@ void NetworkManager::setupRoutes() {
     request->send(200, "text/plain", timeManager.getFormattedTime());
   });
 
+  // Settings as JSON, grouped by ConfigSection (see ConfigJson.h). The
+  // sections go first: the server also hands /api/config/... to a handler
+  // for /api/config.
+  for (uint8_t i = 0; i < (uint8_t)ConfigSection::Count; i++)
+    serveConfigSection((ConfigSection)i);
+
+  // Everything, plus the read-only state (see ConfigJson.h)
+  _server.on("/api/config", HTTP_GET, [this](AsyncWebServerRequest *request) {
+    DynamicJsonDocument doc(CONFIG_JSON_SIZE);
+    ConfigJson(_config).write(doc.to<JsonObject>(), CONFIG_SECTION_ALL);
+    sendJson(request, 200, doc);
+  });
+
+  // Any subset of the sections at once, all or nothing:
+  //   PATCH /api/config {"generation":12,"time":{"ntp":"..."},"display":{...}}
+  AsyncCallbackJsonWebHandler *patch = new AsyncCallbackJsonWebHandler(
+      "/api/config",
+      [this](AsyncWebServerRequest *request, JsonVariant &json) {
+        ConfigJson config(_config);
+        int code = config.patch(json.as<JsonObjectConst>());
+        sendPatchResult(request, config, code);
+      },
+      CONFIG_JSON_SIZE);
+  patch->setMethod(HTTP_PATCH);
+  _server.addHandler(patch);
+
+  // Live needles, time, sync, LEDs and loop timing
+  telemetry.begin(_server);
+
+  // Timezone presets for the Time Settings page
+  _server.on("/api/timezones", HTTP_GET, [](AsyncWebServerRequest *request) {
+    String json = "[";
+    for (size_t i = 0; i < timezoneCount; i++) {
+      json += i ? ",{\"name\":\"" : "{\"name\":\"";
+      json += timezones[i].name;
+      json += "\",\"posix\":\"";
+      json += timezones[i].posix;
+      json += "\"}";
+    }
+    json += "]";
+    request->send(200, "application/json", json);
+  });
+
+  _server.on("/api/system", HTTP_GET, [](AsyncWebServerRequest *request) {
+    char json[96];
+    snprintf(json, sizeof(json),
+             "{\"buildDate\":\"%s\",\"buildTime\":\"%s\",\"freeHeap\":%u}",
+             __DATE__, __TIME__, (unsigned)ESP.getFreeHeap());
+    request->send(200, "application/json", json);
+  });
+
+  // Meter task timing: lateness of each tick against its ideal schedule.
+  // Commands: the web request queue to the frame loop. Telemetry: frames
+  // sent to /ws/telemetry clients and ticks dropped on a full queue.
+  // Preview: values received on /ws/preview and how many the frames took.
+  _server.on("/api/tasks", HTTP_GET, [](AsyncWebServerRequest *request) {
+    JitterStats j = tasks.getJitter();
+    FrameStats f = frames.getStats();
+    CommandStats c = commands.getStats();
+    TelemetryStats t = telemetry.getStats();
+    PreviewStats p = preview.getStats();
+    char json[640];
+    snprintf(json, sizeof(json),
+             "{\"threaded\":%s,\"periodUs\":%d,\"samples\":%u,"
+             "\"overruns\":%u,\"minUs\":%d,\"avgUs\":%d,\"maxUs\":%d,"
+             "\"frame\":{\"fps\":%u,\"leadUs\":%u,\"frames\":%u,"
+             "\"steps\":%u,\"minUs\":%d,\"avgUs\":%d,\"maxUs\":%d},"
+             "\"commands\":{\"size\":%d,\"depth\":%u,\"maxDepth\":%u,"
+             "\"pushed\":%u,\"applied\":%u,\"dropped\":%u,"
+             "\"avgLatencyUs\":%u,\"maxLatencyUs\":%u},"
+             "\"telemetry\":{\"clients\":%u,\"sent\":%u,\"dropped\":%u},"
+             "\"preview\":{\"clients\":%u,\"received\":%u,\"applied\":%u}}",
+             tasks.isThreaded() ? "true" : "false", METER_TASK_PERIOD_US,
+             (unsigned)j.samples, (unsigned)j.overruns, (int)j.minUs,
+             (int)j.avgUs, (int)j.maxUs, (unsigned)frames.getFramesPerSecond(),
+             (unsigned)frames.getLeadUs(), (unsigned)f.frames,
+             (unsigned)f.steps, (int)f.minUs, (int)f.avgUs, (int)f.maxUs,
+             COMMAND_QUEUE_DEPTH, (unsigned)c.depth, (unsigned)c.maxDepth,
+             (unsigned)c.pushed, (unsigned)c.applied, (unsigned)c.dropped,
+             (unsigned)c.avgLatencyUs, (unsigned)c.maxLatencyUs,
+             (unsigned)t.clients, (unsigned)t.sent, (unsigned)t.dropped,
+             (unsigned)p.clients, (unsigned)p.received, (unsigned)p.applied);
+    request->send(200, "application/json", json);
+  });
+
+  _server.on("/api/tasks/reset", HTTP_POST,
+             [](AsyncWebServerRequest *request) {
+               tasks.resetJitter();
+               frames.resetStats();
+               request->send(200, "text/plain", "OK");
+             });
+
+  // Stage timings in us; histogram bucket k counts [2^(k-1), 2^k) us,
+  // trailing empty buckets are left off
+  _server.on("/api/perf", HTTP_GET, [this](AsyncWebServerRequest *request) {
+    String json;
+    json.reserve(1024);
+    json += "{\"cpuMHz\":" + String(ESP.getCpuFreqMHz());
+    json += ",\"overruns\":" + String(perf.getOverruns());
+    json += ",\"stages\":{";
+    for (uint8_t i = 0; i < (uint8_t)PerfStage::Count; i++) {
+      PerfStats p = perf.getStats((PerfStage)i);
+      char buf[96];
+      snprintf(buf, sizeof(buf),
+               "%s\"%s\":{\"n\":%u,\"min\":%u,\"avg\":%u,\"max\":%u,"
+               "\"hist\":[",
+               i ? "," : "", Profiler::stageName((PerfStage)i),
+               (unsigned)p.count, (unsigned)p.minUs, (unsigned)p.avgUs,
+               (unsigned)p.maxUs);
+      json += buf;
+      int last = PERF_BUCKETS - 1;
+      while (last >= 0 && p.hist[last] == 0)
+        last--;
+      for (int b = 0; b <= last; b++) {
+        if (b)
+          json += ",";
+        json += String(p.hist[b]);
+      }
+      json += "]}";
+    }
+
+    // Settings writes: each of the saves was unchanged or a change (writes),
+    // and the changes went out in flushes blob writes
+    ConfigWriteStats w = _config.getWriteStats();
+    char buf[192];
+    snprintf(buf, sizeof(buf),
+             "},\"nvs\":{\"saves\":%u,\"unchanged\":%u,\"coalesced\":%u,"
+             "\"writes\":%u,\"flushes\":%u,\"loadUs\":%u,\"fromBlob\":%s}}",
+             (unsigned)w.saves, (unsigned)w.unchanged, (unsigned)w.coalesced,
+             (unsigned)w.writes, (unsigned)w.flushes,
+             (unsigned)_config.getLoadUs(),
+             _config.loadedFromBlob() ? "true" : "false");
+    json += buf;
+    request->send(200, "application/json", json);
+  });
+
+  _server.on("/api/perf/reset", HTTP_POST, [](AsyncWebServerRequest *request) {
+    perf.reset();
+    request->send(200, "text/plain", "OK");
+  });
+
+  // LED frame time against strip length. POST starts a run (the strip
+  // flashes), GET returns the last one.
+  _server.on("/api/leds/bench", HTTP_POST,
+             [](AsyncWebServerRequest *request) {
+               lighting.requestBenchmark();
+               request->send(202, "text/plain", "Started");
+             });
+
+  _server.on("/api/leds/bench", HTTP_GET, [](AsyncWebServerRequest *request) {
+    if (!lighting.hasBenchmark()) {
+      request->send(404, "text/plain", "No benchmark yet");
+      return;
+    }
+    const LedBenchResult *r = lighting.getBenchmark();
+    String json = "[";
+    for (uint8_t i = 0; i < LED_BENCH_STEPS; i++) {
+      char buf[80];
+      snprintf(buf, sizeof(buf),
+               "%s{\"count\":%u,\"showUs\":%u,\"wireUs\":%u,"
+               "\"expectedUs\":%u}",
+               i ? "," : "", r[i].count, (unsigned)r[i].showUs,
+               (unsigned)r[i].wireUs,
+               (unsigned)LedOutput::wireTimeUs(r[i].count));
+      json += buf;
+    }
+    json += "]";
+    request->send(200, "application/json", json);
+  });
+
+  // Night from 22:15, rebuilt into the schedule as /save_led does, and the
+  // keyframes read back
   _server.on("/test_save", HTTP_GET, [this](AsyncWebServerRequest *request) {
-    _config.saveNightStart(22);
-    _config.saveNightStartMinute(15);
-    String res = "Saved 22:15. Read back: ";
-    res += String(_config.getNightStart()) + ":" +
-           String(_config.getNightStartMinute());
+    {
+      Config::Transaction tx(_config);
+      _config.saveNightStart(22);
+      _config.saveNightStartMinute(15);
+      _config.saveLightSchedule(_config.dayNightSchedule());
+    }
+    String res = "Saved 22:15. Read back:";
+    const LightSchedulePoints &s = _config.getLightSchedule();
+    for (uint8_t i = 0; i < s.count; i++) {
+      char t[16];
+      snprintf(t, sizeof(t), " %02u:%02u", s.keys[i].minute / 60,
+               s.keys[i].minute % 60);
+      res += t;
+    }
     request->send(200, "text/plain", res);
   });
 }
@@ -910,51 +944,50 @@ void NetworkManager::loop() {
   }
 }
 
+void NetworkManager::serveConfigSection(ConfigSection section) {
+  String uri = String("/api/config/") + configSectionName(section);
+  _server.on(uri.c_str(), HTTP_GET,
+             [this, section](AsyncWebServerRequest *request) {
+               DynamicJsonDocument doc(CONFIG_JSON_SIZE);
+               ConfigJson(_config).writeSection(doc.to<JsonObject>(), section);
+               sendJson(request, 200, doc);
+             });
+
+  AsyncCallbackJsonWebHandler *patch = new AsyncCallbackJsonWebHandler(
+      uri,
+      [this, section](AsyncWebServerRequest *request, JsonVariant &json) {
+        ConfigJson config(_config);
+        int code = config.patchSection(section, json.as<JsonObjectConst>());
+        sendPatchResult(request, config, code);
+      },
+      CONFIG_JSON_SIZE);
+  patch->setMethod(HTTP_PATCH);
+  _server.addHandler(patch);
+}
+
+// {"generation":13,"changed":true}, or {"error":"time.ntp: ..."}. Nothing
+// is saved unless the code is 200; what the settings drive (the clock, the
+// needles, the LEDs) follows from the config listeners at the next frame.
+void NetworkManager::sendPatchResult(AsyncWebServerRequest *request,
+                                     ConfigJson &config, int code) {
+  StaticJsonDocument<JSON_OBJECT_SIZE(2)> doc;
+  if (code == 200) {
+    doc["generation"] = _config.getGeneration();
+    doc["changed"] = config.changed();
+  } else {
+    doc["error"] = config.getError().c_str();
+  }
+  sendJson(request, code, doc);
+}
+
+void NetworkManager::serveAsset(const char *url, const char *name) {
+  const WebAsset *asset = findAsset(name);
+  _server.on(url, HTTP_GET, [asset](AsyncWebServerRequest *request) {
+    sendAsset(request, *asset);
+  });
+}
+
+// For the few responses still built in code
 String NetworkManager::getCommonStyle() {
-  String css = "<style>";
-  css += "* { box-sizing: border-box; }";
-  css += "body { font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif; "
-         "background-color: #121212; color: #e0e0e0; max-width: 600px; margin: "
-         "0 auto; padding: 20px; font-size: 16px; line-height: 1.6; }";
-  css += "h1, h2, h3 { color: #ffffff; text-align: center; }";
-  css += "h3 { border-bottom: 2px solid #07f67a8d; padding-bottom: 10px; "
-         "margin-top: 30px; }";
-  css += "a { color: #07f67a8d; text-decoration: none; }";
-  css += "a:hover { text-decoration: underline; }";
-  css += "input[type='text'], input[type='password'], input[type='number'], "
-         "input[type='color'], input[type='datetime-local'], select { "
-         "width: 100%; padding: 12px; margin: 8px 0; box-sizing: border-box; "
-         "font-size: 16px; background-color: #2d2d2d; color: #fff; "
-         "border: 1px solid #555; border-radius: 4px; }";
-  css += "input[type='color'] { height: 50px; padding: 2px; }";
-  css += "input[type='submit'], button, .btn { background-color: #07f67a8d; "
-         "color: #121212; font-weight: bold; padding: 14px 20px; margin: 8px "
-         "0; border: none; cursor: pointer; width: 100%; font-size: 16px; "
-         "border-radius: 4px; display: block; text-align: center; }";
-  css += "input[type='submit']:hover, button:hover, .btn:hover { "
-         "background-color: #07f67ad8; text-decoration: none; }";
-  css += ".btn-danger, .danger { background-color: #ef5350; color: white; }";
-  css += ".btn-danger:hover, .danger:hover { background-color: #d32f2f; }";
-  css += ".card { background-color: #1e1e1e; padding: 20px; border-radius: "
-         "8px; box-shadow: 0 4px 6px rgba(0,0,0,0.3); margin-bottom: 20px; }";
-  css += "label { display: block; margin-top: 15px; font-weight: bold; "
-         "color: #b0bec5; }";
-  css +=
-      ".info { background-color: #263238; padding: 15px; border-left: 4px "
-      "solid #07f67a8d; margin: 15px 0; font-size: 14px; border-radius: 0 4px "
-      "4px 0; }";
-  css += ".success { color: #66bb6a; } .error { color: #ef5350; }"; // Green/Red
-  css += ".slider-container { display: flex; align-items: center; gap: 10px; }";
-  css += ".slider-container input[type='range'] { flex: 1; accent-color: "
-         "#07f67a8d; }";
-  css += ".slider-value { min-width: 50px; text-align: right; font-weight: "
-         "bold; color: #07f67a8d; }";
-  css += ".radio-group { margin: 10px 0; display: flex; gap: 20px; }";
-  css += ".radio-group label { margin: 0; font-weight: normal; cursor: "
-         "pointer; display: flex; align-items: center; gap: 5px; color: "
-         "#e0e0e0; }";
-  css += "input[type='radio'] { accent-color: #07f67a8d; width: 20px; height: "
-         "20px; }";
-  css += "</style>";
-  return css;
+  return "<link rel='stylesheet' href='" WEB_STYLE_CSS_URL "'>";
 }
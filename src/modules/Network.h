@@ -1,17 +1,32 @@
 #pragma once
 #include <Arduino.h>
 #include <DNSServer.h>
+#include <ArduinoJson.h>
 #include <ESPAsyncWebServer.h>
 #include <WiFi.h>
 
 #include "Config.h"
 
+class ConfigJson;
+
+// Timezone presets offered on the Time Settings page
+struct TZOption {
+  const char *name;
+  const char *posix;
+};
+extern const TZOption timezones[];
+extern const size_t timezoneCount;
+
 class NetworkManager {
 public:
   NetworkManager(Config &config);
   void begin();
   void loop(); // Handle DNS requests
 
+  // Frame loop (CommandType::WiFiTest): join the saved network alongside
+  // the AP, or drop back to the AP alone
+  void testStation(bool on);
+
 private:
   Config &_config;
   AsyncWebServer _server;
@@ -27,7 +42,10 @@ private:
   String getCommonStyle();
   void connectWiFi();
   void setupRoutes();
+  void serveAsset(const char *url, const char *name); // From web/
+  void serveConfigSection(ConfigSection section); // /api/config/<name>
+  void sendPatchResult(AsyncWebServerRequest *request, ConfigJson &config,
+                       int code);
   void startAsyncScan();
-  String getWiFiScanHTML();
   void sendWifiPage(AsyncWebServerRequest *request);
 };
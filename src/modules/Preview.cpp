@@ -0,0 +1,95 @@
+#include "Preview.h"
+#include "Lighting.h"
+#include <ArduinoJson.h>
+
+extern Lighting lighting;
+
+#define PREVIEW_NONE -1
+#define PREVIEW_MAX_PWM 1023
+
+Preview::Preview()
+    : _ws(PREVIEW_URL), _received(0), _lightOwner(0), _applied(0) {
+  for (auto &v : _cal)
+    v.store(PREVIEW_NONE, std::memory_order_relaxed);
+}
+
+void Preview::begin(AsyncWebServer &server) {
+  _ws.onEvent([this](AsyncWebSocket *, AsyncWebSocketClient *client,
+                     AwsEventType type, void *arg, uint8_t *data,
+                     size_t len) { onEvent(client, type, arg, data, len); });
+  server.addHandler(&_ws);
+}
+
+void Preview::onEvent(AsyncWebSocketClient *client, AwsEventType type,
+                      void *arg, uint8_t *data, size_t len) {
+  if (type == WS_EVT_CONNECT) {
+    if (_ws.count() > PREVIEW_MAX_CLIENTS)
+      client->close(1013, "Too many clients"); // Try again later
+    return;
+  }
+  if (type == WS_EVT_DISCONNECT) {
+    // Page closed mid-preview; another page's preview is left alone
+    uint32_t id = client->id();
+    if (_lightOwner.compare_exchange_strong(id, 0))
+      lighting.clearPreview();
+    return;
+  }
+  if (type != WS_EVT_DATA)
+    return;
+
+  // One value per message, in one frame
+  AwsFrameInfo *info = (AwsFrameInfo *)arg;
+  if (!info->final || info->index != 0 || info->len != len ||
+      info->opcode != WS_TEXT)
+    return;
+  StaticJsonDocument<JSON_OBJECT_SIZE(2) + 32> doc; // + the strings
+  if (deserializeJson(doc, (const char *)data, len))
+    return;
+  const char *color = doc["color"];
+  if (doc["cal"].is<int>() && doc["value"].is<int>()) {
+    setCalibration(doc["cal"].as<int>(), doc["value"].as<int>());
+  } else if (color && color[0] == '#' && strlen(color) == 7 &&
+             doc["brightness"].is<int>()) {
+    setLight(strtoul(color + 1, nullptr, 16),
+             constrain(doc["brightness"].as<int>(), 0, 255), client->id());
+  } else if (doc["revert"] == true) {
+    revertLight();
+  }
+}
+
+void Preview::setCalibration(uint8_t meter, int value) {
+  if (meter >= 3)
+    return;
+  _cal[meter].store(constrain(value, 0, PREVIEW_MAX_PWM),
+                    std::memory_order_relaxed);
+  _received.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Straight to the LED task, which takes the newest at its next frame
+void Preview::setLight(uint32_t color, uint8_t brightness, uint32_t owner) {
+  _lightOwner.store(owner);
+  lighting.setPreview(color, brightness);
+  _received.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Preview::revertLight() {
+  _lightOwner.store(0);
+  lighting.clearPreview();
+}
+
+bool Preview::takeCalibration(uint8_t meter, int16_t &value) {
+  int32_t v = _cal[meter].exchange(PREVIEW_NONE, std::memory_order_relaxed);
+  if (v == PREVIEW_NONE)
+    return false;
+  value = v;
+  _applied++;
+  return true;
+}
+
+PreviewStats Preview::getStats() {
+  PreviewStats s;
+  s.clients = _ws.count();
+  s.received = _received.load(std::memory_order_relaxed);
+  s.applied = _applied;
+  return s;
+}
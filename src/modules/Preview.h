@@ -0,0 +1,55 @@
+#pragma once
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <atomic>
+
+// Live previews from the settings pages over one WebSocket. Each message
+// overwrites a mailbox slot and the frame loop takes whatever is newest at
+// the start of the next frame, so a burst of keystrokes moves the needle
+// once per frame instead of queueing up behind each other.
+//   {"cal":0,"value":512}  Hour needle (CAL_METER_*) to PWM 512; ignored
+//                          unless calibration mode is on
+//   {"color":"#ff8800","brightness":200}
+//                          LED look in place of the schedule (see
+//                          Lighting::setPreview()); it times out 30 s
+//                          after the last one, or when the page that
+//                          sent it goes
+//   {"revert":true}        Back to the schedule now
+// Nothing is saved: the pages still commit through their normal forms.
+#define PREVIEW_URL "/ws/preview"
+#define PREVIEW_MAX_CLIENTS 2
+
+struct PreviewStats {
+  uint8_t clients;
+  uint32_t received; // Values posted, needles and LEDs
+  uint32_t applied;  // Needle values taken by the frame loop; the rest
+                     // were overwritten
+};
+
+class Preview {
+public:
+  Preview();
+  void begin(AsyncWebServer &server);
+
+  // Any task: replaces a value the frame loop hasn't taken yet
+  void setCalibration(uint8_t meter, int value);
+
+  // owner: the WebSocket client id the preview came from, 0 if none
+  void setLight(uint32_t color, uint8_t brightness, uint32_t owner = 0);
+  void revertLight();
+
+  // Frame loop: the newest value since the last take, false if none
+  bool takeCalibration(uint8_t meter, int16_t &value);
+
+  PreviewStats getStats();
+
+private:
+  AsyncWebSocket _ws;
+  std::atomic<int32_t> _cal[3]; // -1 = nothing new
+  std::atomic<uint32_t> _received;
+  std::atomic<uint32_t> _lightOwner; // Client of the last LED preview
+  uint32_t _applied;
+
+  void onEvent(AsyncWebSocketClient *client, AwsEventType type, void *arg,
+               uint8_t *data, size_t len);
+};
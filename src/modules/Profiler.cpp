@@ -0,0 +1,60 @@
+#include "Profiler.h"
+
+static const char *STAGE_NAMES[(uint8_t)PerfStage::Count] = {
+    "network", "time",   "mapping", "lighting", "ledFrame",
+    "meterH",  "meterM", "meterS",  "frame"};
+
+Profiler::Profiler() : _overruns(0), _cyclesPerUs(0) {
+  memset((void *)_slots, 0, sizeof(_slots));
+}
+
+void Profiler::record(PerfStage stage, uint32_t startCycles) {
+  uint32_t cycles = ESP.getCycleCount() - startCycles; // Wraps every ~18 s
+  Slot &s = _slots[(uint8_t)stage];
+
+  // Cleared by the recording task, so a reset never races a sample
+  if (s.resetRequested) {
+    s.resetRequested = false;
+    s.count = 0;
+    s.sumCycles = 0;
+    for (uint8_t i = 0; i < PERF_BUCKETS; i++)
+      s.hist[i] = 0;
+  }
+  if (s.count == 0 || cycles < s.minCycles)
+    s.minCycles = cycles;
+  if (s.count == 0 || cycles > s.maxCycles)
+    s.maxCycles = cycles;
+  s.sumCycles += cycles;
+  s.count++;
+
+  if (_cyclesPerUs == 0)
+    _cyclesPerUs = ESP.getCpuFreqMHz();
+  uint32_t us = cycles / _cyclesPerUs;
+  uint8_t bucket = us ? 32 - __builtin_clz(us) : 0;
+  if (bucket >= PERF_BUCKETS)
+    bucket = PERF_BUCKETS - 1;
+  s.hist[bucket]++;
+}
+
+PerfStats Profiler::getStats(PerfStage stage) {
+  const Slot &s = _slots[(uint8_t)stage];
+  uint32_t mhz = _cyclesPerUs ? _cyclesPerUs : ESP.getCpuFreqMHz();
+  PerfStats p;
+  p.count = s.count;
+  p.minUs = p.count ? s.minCycles / mhz : 0;
+  p.maxUs = p.count ? s.maxCycles / mhz : 0;
+  p.avgUs = p.count ? (uint32_t)(s.sumCycles / p.count / mhz) : 0;
+  for (uint8_t i = 0; i < PERF_BUCKETS; i++)
+    p.hist[i] = s.hist[i];
+  return p;
+}
+
+const char *Profiler::stageName(PerfStage stage) {
+  return STAGE_NAMES[(uint8_t)stage];
+}
+
+void Profiler::reset() {
+  for (uint8_t i = 0; i < (uint8_t)PerfStage::Count; i++)
+    _slots[i].resetRequested = true;
+  _overruns = 0;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <Arduino.h>
+
+// Log2 latency buckets: bucket 0 is < 1 us, bucket k is [2^(k-1), 2^k) us,
+// the last one also takes everything longer (>= 16 ms)
+#define PERF_BUCKETS 16
+
+// Timed sections of the firmware
+enum class PerfStage : uint8_t {
+  Network = 0,  // network.loop() (housekeeping)
+  Time = 1,     // timeManager.update() (housekeeping)
+  Mapping = 2,  // Time capture to meter targets (frame)
+  Lighting = 3, // lighting.update() (frame)
+  LedFrame = 4, // lighting.refresh() that ran (housekeeping)
+  MeterH = 5,   // meterH.update() (meter tick)
+  MeterM = 6,
+  MeterS = 7,
+  Frame = 8, // Whole frame in loop()
+  Count = 9,
+};
+
+struct PerfStats {
+  uint32_t count;
+  uint32_t minUs;
+  uint32_t maxUs;
+  uint32_t avgUs; // Since the last reset
+  uint32_t hist[PERF_BUCKETS];
+};
+
+// Always-on cycle counter profiling. Each stage must only be recorded from
+// one task; readers get a snapshot that may be a sample behind.
+//
+//   uint32_t t0 = perf.start();
+//   timeManager.update();
+//   perf.record(PerfStage::Time, t0);
+class Profiler {
+public:
+  Profiler();
+
+  uint32_t start() const { return ESP.getCycleCount(); }
+  void record(PerfStage stage, uint32_t startCycles);
+
+  // A frame that was still computing when its boundary passed
+  void recordOverrun() { _overruns++; }
+  uint32_t getOverruns() const { return _overruns; }
+
+  PerfStats getStats(PerfStage stage);
+  static const char *stageName(PerfStage stage);
+  void reset();
+
+private:
+  struct Slot {
+    volatile uint32_t count;
+    volatile uint32_t minCycles;
+    volatile uint32_t maxCycles;
+    volatile uint64_t sumCycles;
+    volatile uint32_t hist[PERF_BUCKETS];
+    volatile bool resetRequested;
+  };
+
+  Slot _slots[(uint8_t)PerfStage::Count];
+  volatile uint32_t _overruns;
+  uint32_t _cyclesPerUs;
+};
@@ -0,0 +1,49 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// Lock-free publication of a struct from one task to readers on others (a
+// seqlock over two copies). publish() rewrites one copy while the sequence
+// points readers at the other, then does the same the other way round, so
+// readers never wait for a writer and never keep half of an update: a
+// read that overlaps a publish just copies again.
+//
+// Writers must be serialized by the caller (one task, or a lock).
+template <typename T> class Snapshot {
+public:
+  Snapshot() : _seq(0) {}
+  explicit Snapshot(const T &initial) : _seq(0) {
+    _buf[0] = initial;
+    _buf[1] = initial;
+  }
+
+  void publish(const T &value) {
+    uint32_t seq = _seq.load(std::memory_order_relaxed);
+    _seq.store(seq + 1, std::memory_order_relaxed); // Odd: read _buf[1]
+    std::atomic_thread_fence(std::memory_order_release);
+    _buf[0] = value;
+    _seq.store(seq + 2, std::memory_order_release); // Even: read _buf[0]
+    std::atomic_thread_fence(std::memory_order_release);
+    _buf[1] = value;
+  }
+
+  T read() const {
+    T copy;
+    read(copy);
+    return copy;
+  }
+
+  // Copy into `out`, for large T
+  void read(T &out) const {
+    uint32_t seq;
+    do {
+      seq = _seq.load(std::memory_order_acquire);
+      out = _buf[seq & 1];
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while (_seq.load(std::memory_order_relaxed) != seq);
+  }
+
+private:
+  T _buf[2];
+  std::atomic<uint32_t> _seq;
+};
@@ -0,0 +1,124 @@
+#include "Tasks.h"
+#include "esp_timer.h"
+
+TaskManager::TaskManager()
+    : _meterTick(nullptr), _housekeeping(nullptr), _lastTickUs(0),
+      _samples(0), _overruns(0), _minUs(0), _maxUs(0), _avgQ4(0),
+      _resetRequested(false)
+#if CLOCK_RTOS_TASKS
+      ,
+      _meterTask(nullptr)
+#endif
+{
+}
+
+void TaskManager::begin(TaskFn meterTick, TaskFn housekeeping) {
+  _meterTick = meterTick;
+  _housekeeping = housekeeping;
+  _lastTickUs = (uint32_t)esp_timer_get_time();
+
+#if CLOCK_RTOS_TASKS
+  xTaskCreatePinnedToCore(meterTaskMain, "meters", METER_TASK_STACK, this,
+                          METER_TASK_PRIORITY, &_meterTask, METER_TASK_CORE);
+
+  xTaskCreatePinnedToCore(housekeepingTaskMain, "housekeeping",
+                          HOUSEKEEPING_TASK_STACK, this,
+                          HOUSEKEEPING_TASK_PRIORITY, nullptr,
+                          HOUSEKEEPING_TASK_CORE);
+
+  esp_timer_create_args_t args = {};
+  args.callback = onTimer;
+  args.arg = this;
+  args.name = "meterTick";
+  esp_timer_handle_t timer;
+  esp_timer_create(&args, &timer);
+  esp_timer_start_periodic(timer, METER_TASK_PERIOD_US);
+
+  Serial.printf("Meter task on core %d (prio %d), housekeeping on core %d "
+                "(prio %d)\r\n",
+                METER_TASK_CORE, METER_TASK_PRIORITY, HOUSEKEEPING_TASK_CORE,
+                HOUSEKEEPING_TASK_PRIORITY);
+#endif
+}
+
+void TaskManager::poll() {
+#if !CLOCK_RTOS_TASKS
+  _housekeeping();
+
+  uint32_t now = (uint32_t)esp_timer_get_time();
+  uint32_t elapsed = now - _lastTickUs;
+  if (elapsed >= METER_TASK_PERIOD_US) {
+    _lastTickUs = now;
+    int32_t late = elapsed - METER_TASK_PERIOD_US;
+    recordJitter(late, late / METER_TASK_PERIOD_US);
+    _meterTick();
+  }
+#endif
+}
+
+void TaskManager::recordJitter(int32_t lateUs, uint32_t missed) {
+  if (_resetRequested) {
+    _resetRequested = false;
+    _samples = 0;
+    _overruns = 0;
+  }
+  if (_samples == 0 || lateUs < _minUs)
+    _minUs = lateUs;
+  if (_samples == 0 || lateUs > _maxUs)
+    _maxUs = lateUs;
+  if (_samples == 0)
+    _avgQ4 = lateUs * 16;
+  else
+    _avgQ4 += (lateUs * 16 - _avgQ4) / 64;
+  _overruns += missed;
+  _samples++;
+}
+
+JitterStats TaskManager::getJitter() {
+  JitterStats s;
+  s.samples = _samples;
+  s.overruns = _overruns;
+  s.minUs = _minUs;
+  s.maxUs = _maxUs;
+  s.avgUs = _avgQ4 / 16;
+  return s;
+}
+
+// Cleared by the owning task on its next sample, so it never races
+void TaskManager::resetJitter() { _resetRequested = true; }
+
+#if CLOCK_RTOS_TASKS
+void TaskManager::onTimer(void *arg) {
+  TaskManager *self = (TaskManager *)arg;
+  xTaskNotifyGive(self->_meterTask);
+}
+
+void TaskManager::meterTaskMain(void *arg) {
+  TaskManager *self = (TaskManager *)arg;
+  int64_t expected = 0;
+
+  for (;;) {
+    uint32_t ticks = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+
+    // Jitter against the ideal grid; missed wakeups count as overruns.
+    // The grid is anchored on the first wakeup and after long stalls.
+    if (expected == 0 || now - expected > 100000 || expected - now > 100000) {
+      expected = now;
+    }
+    expected += (int64_t)(ticks - 1) * METER_TASK_PERIOD_US;
+    self->recordJitter((int32_t)(now - expected), ticks - 1);
+    expected += METER_TASK_PERIOD_US;
+
+    self->_meterTick();
+  }
+}
+
+void TaskManager::housekeepingTaskMain(void *arg) {
+  TaskManager *self = (TaskManager *)arg;
+  for (;;) {
+    self->_housekeeping();
+    vTaskDelay(pdMS_TO_TICKS(HOUSEKEEPING_PERIOD_MS));
+  }
+}
+#endif
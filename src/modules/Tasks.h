@@ -0,0 +1,83 @@
+#pragma once
+#include <Arduino.h>
+
+// Task layout. Override any of these with build_flags in platformio.ini.
+// With CLOCK_RTOS_TASKS=0 everything runs cooperatively from loop().
+#ifndef CLOCK_RTOS_TASKS
+#define CLOCK_RTOS_TASKS 1
+#endif
+
+// Meter servo task: esp_timer driven, owns meterH/M/S
+#ifndef METER_TASK_CORE
+#define METER_TASK_CORE 1
+#endif
+#ifndef METER_TASK_PRIORITY
+#define METER_TASK_PRIORITY (configMAX_PRIORITIES - 2)
+#endif
+#ifndef METER_TASK_STACK
+#define METER_TASK_STACK 3072
+#endif
+#ifndef METER_TASK_PERIOD_US
+#define METER_TASK_PERIOD_US 1000
+#endif
+
+// Housekeeping task: DNS, RTC sync and other slow work
+#ifndef HOUSEKEEPING_TASK_CORE
+#define HOUSEKEEPING_TASK_CORE 0
+#endif
+#ifndef HOUSEKEEPING_TASK_PRIORITY
+#define HOUSEKEEPING_TASK_PRIORITY 1
+#endif
+#ifndef HOUSEKEEPING_TASK_STACK
+#define HOUSEKEEPING_TASK_STACK 6144
+#endif
+#ifndef HOUSEKEEPING_PERIOD_MS
+#define HOUSEKEEPING_PERIOD_MS 2
+#endif
+
+// How late the meter tick ran relative to its ideal schedule
+struct JitterStats {
+  uint32_t samples;
+  uint32_t overruns; // Ticks missed entirely (woke more than a period late)
+  int32_t minUs;
+  int32_t maxUs;
+  int32_t avgUs; // Moving average over roughly the last 64 ticks
+};
+
+class TaskManager {
+public:
+  typedef void (*TaskFn)();
+
+  TaskManager();
+  void begin(TaskFn meterTick, TaskFn housekeeping);
+
+  // Call from loop(). Cooperative: runs the meter tick and housekeeping.
+  // Threaded: does nothing, loop() blocks on the frame scheduler instead.
+  void poll();
+
+  bool isThreaded() const { return CLOCK_RTOS_TASKS; }
+  JitterStats getJitter();
+  void resetJitter();
+
+private:
+  TaskFn _meterTick;
+  TaskFn _housekeeping;
+  uint32_t _lastTickUs;
+
+  // Jitter accumulators (written by the meter task only)
+  volatile uint32_t _samples;
+  volatile uint32_t _overruns;
+  volatile int32_t _minUs;
+  volatile int32_t _maxUs;
+  volatile int32_t _avgQ4; // EWMA, 4 fractional bits
+  volatile bool _resetRequested;
+
+  void recordJitter(int32_t lateUs, uint32_t missed);
+
+#if CLOCK_RTOS_TASKS
+  TaskHandle_t _meterTask;
+  static void onTimer(void *arg);
+  static void meterTaskMain(void *arg);
+  static void housekeepingTaskMain(void *arg);
+#endif
+};
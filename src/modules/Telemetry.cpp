@@ -0,0 +1,168 @@
+#include "Telemetry.h"
+#include "FrameScheduler.h"
+#include "Lighting.h"
+#include "Meter.h"
+#include "Profiler.h"
+#include "Tasks.h"
+#include <ArduinoJson.h>
+
+extern Meter meterH;
+extern Meter meterM;
+extern Meter meterS;
+extern Lighting lighting;
+extern FrameScheduler frames;
+extern TaskManager tasks;
+extern Profiler perf;
+extern TimeManager timeManager;
+
+#define TELEMETRY_CLEANUP_MS 1000
+
+static const char *const SOURCE_NAMES[] = {"none", "ntp", "rtc", "manual"};
+
+Telemetry::Telemetry()
+    : _ws(TELEMETRY_URL), _clients(), _frame(FrameTelemetry()),
+      _lastCleanup(0), _sent(0), _dropped(0) {}
+
+void Telemetry::begin(AsyncWebServer &server) {
+  _ws.onEvent([this](AsyncWebSocket *, AsyncWebSocketClient *client,
+                     AwsEventType type, void *arg, uint8_t *data,
+                     size_t len) { onEvent(client, type, arg, data, len); });
+  server.addHandler(&_ws);
+}
+
+void Telemetry::onEvent(AsyncWebSocketClient *client, AwsEventType type,
+                        void *arg, uint8_t *data, size_t len) {
+  if (type == WS_EVT_CONNECT) {
+    for (Client &c : _clients) {
+      if (c.id == 0) {
+        setRate(c, TELEMETRY_DEFAULT_HZ);
+        c.seq = 0;
+        c.id = client->id();
+        return;
+      }
+    }
+    client->close(1013, "Too many clients"); // Try again later
+    return;
+  }
+
+  for (Client &c : _clients) {
+    if (c.id != client->id())
+      continue;
+    if (type == WS_EVT_DISCONNECT) {
+      c.id = 0;
+    } else if (type == WS_EVT_DATA) {
+      // {"hz":20}, in one frame
+      AwsFrameInfo *info = (AwsFrameInfo *)arg;
+      StaticJsonDocument<JSON_OBJECT_SIZE(1) + 16> doc; // + the key
+      if (info->final && info->index == 0 && info->len == len &&
+          info->opcode == WS_TEXT &&
+          !deserializeJson(doc, (const char *)data, len) &&
+          doc["hz"].is<long>())
+        setRate(c, doc["hz"].as<long>());
+    }
+    return;
+  }
+}
+
+void Telemetry::setRate(Client &c, long hz) {
+  hz = constrain(hz, TELEMETRY_MIN_HZ, TELEMETRY_MAX_HZ);
+  c.periodUs = 1000000 / hz;
+  c.nextUs = micros(); // Next loop()
+}
+
+void Telemetry::loop() {
+  if (millis() - _lastCleanup >= TELEMETRY_CLEANUP_MS) {
+    _lastCleanup = millis();
+    _ws.cleanupClients(TELEMETRY_MAX_CLIENTS);
+  }
+
+  // The body is built at most once per pass and shared by the clients due
+  char frame[TELEMETRY_FRAME_SIZE];
+  const size_t head = 24; // Room for {"seq":4294967295,
+  size_t body = 0;
+  uint32_t now = micros();
+  for (Client &c : _clients) {
+    uint32_t id = c.id;
+    if (id == 0 || (int32_t)(now - c.nextUs) < 0)
+      continue;
+    // A late pass sends one frame, it doesn't catch up
+    c.nextUs += c.periodUs;
+    if ((int32_t)(now - c.nextUs) >= 0)
+      c.nextUs = now + c.periodUs;
+    c.seq++;
+
+    AsyncWebSocketClient *client = _ws.client(id);
+    if (!client)
+      continue;
+    if (client->queueIsFull()) {
+      _dropped++;
+      continue;
+    }
+    if (body == 0)
+      body = build(frame + head, sizeof(frame) - head);
+    if (body == 0)
+      return; // Didn't fit
+
+    char seq[head + 1];
+    size_t n = snprintf(seq, sizeof(seq), "{\"seq\":%u,", (unsigned)c.seq);
+    memcpy(frame + head - n, seq, n);
+    client->text(frame + head - n, n + body);
+    _sent++;
+  }
+}
+
+// Everything after {"seq":N, up to the closing brace
+size_t Telemetry::build(char *out, size_t size) {
+  FrameTelemetry f;
+  _frame.read(f);
+  const TimeSnapshot &t = f.time;
+  Meter *meters[] = {&meterH, &meterM, &meterS};
+  PerfStats frame = perf.getStats(PerfStage::Frame);
+  FrameStats timer = frames.getStats();
+  JitterStats tick = tasks.getJitter();
+  unsigned long syncMs = TimeManager::getLastNtpSyncMs();
+  long syncAgeS = syncMs ? (long)((millis() - syncMs) / 1000) : -1;
+
+  int n = snprintf(
+      out, size,
+      "\"time\":{\"utc\":%ld,\"us\":%u,\"local\":\"%02d:%02d:%02d\","
+      "\"valid\":%s,\"source\":\"%s\"},"
+      "\"sync\":{\"ntp\":%s,\"ntpSyncs\":%u,\"ntpAgeS\":%ld,\"rtc\":%s},"
+      "\"meters\":[",
+      (long)t.utc, (unsigned)t.micros, t.local.tm_hour, t.local.tm_min,
+      t.local.tm_sec, t.valid ? "true" : "false",
+      SOURCE_NAMES[(uint8_t)t.source], f.useNTP ? "true" : "false",
+      (unsigned)TimeManager::getNtpSyncs(), syncAgeS,
+      timeManager.hasRTC() ? "true" : "false");
+  for (uint8_t i = 0; i < 3 && n > 0 && (size_t)n < size; i++) {
+    n += snprintf(out + n, size - n, "%s{\"duty\":%d,\"target\":%.1f}",
+                  i ? "," : "", meters[i]->getDuty(),
+                  meters[i]->getTarget());
+  }
+  if (n > 0 && (size_t)n < size) {
+    n += snprintf(
+        out + n, size - n,
+        "],\"led\":{\"color\":\"#%06x\",\"brightness\":%u,\"error\":%s,"
+        "\"preview\":%s,\"count\":%u},"
+        "\"loop\":{\"fps\":%u,\"leadUs\":%u,\"frameAvgUs\":%u,"
+        "\"frameMaxUs\":%u,\"overruns\":%u,\"timerAvgUs\":%d,"
+        "\"tickMaxUs\":%d}}",
+        (unsigned)(f.look.color & 0xFFFFFF), (unsigned)f.look.brightness,
+        f.ledError ? "true" : "false",
+        lighting.isPreviewing() ? "true" : "false", (unsigned)lighting.getCount(),
+        (unsigned)frames.getFramesPerSecond(), (unsigned)frames.getLeadUs(),
+        (unsigned)frame.avgUs, (unsigned)frame.maxUs,
+        (unsigned)perf.getOverruns(), (int)timer.avgUs, (int)tick.maxUs);
+  }
+  return (n > 0 && (size_t)n < size) ? n : 0;
+}
+
+TelemetryStats Telemetry::getStats() const {
+  TelemetryStats s;
+  s.clients = 0;
+  for (const Client &c : _clients)
+    s.clients += c.id != 0;
+  s.sent = _sent;
+  s.dropped = _dropped;
+  return s;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "Config.h"
+#include "Snapshot.h"
+#include "TimeManager.h"
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+// Live state over a WebSocket: needles, time, sync, LEDs and loop timing,
+// one JSON text frame per tick. A client picks its rate by sending
+// {"hz":20} (1-50, 10 until it does).
+#define TELEMETRY_URL "/ws/telemetry"
+#define TELEMETRY_MAX_CLIENTS 4
+#define TELEMETRY_DEFAULT_HZ 10
+#define TELEMETRY_MIN_HZ 1
+#define TELEMETRY_MAX_HZ 50
+#define TELEMETRY_FRAME_SIZE 640
+
+// Frames are never queued behind ones the client hasn't taken yet: a tick
+// that finds the client's send queue full (WS_MAX_QUEUED_MESSAGES, see
+// platformio.ini) is dropped, and the next one carries fresher data.
+// "seq" counts ticks, so a gap in it is a drop.
+
+// What the last frame computed, published by the frame loop
+struct FrameTelemetry {
+  TimeSnapshot time;
+  LightKeyframe look;
+  bool ledError;
+  bool useNTP;
+};
+
+struct TelemetryStats {
+  uint8_t clients;
+  uint32_t sent;
+  uint32_t dropped;
+};
+
+class Telemetry {
+public:
+  Telemetry();
+  void begin(AsyncWebServer &server);
+
+  // Frame loop, once per frame
+  void publishFrame(const FrameTelemetry &frame) { _frame.publish(frame); }
+
+  // Housekeeping task: sends the frames that are due
+  void loop();
+
+  TelemetryStats getStats() const;
+
+private:
+  // Written by the WebSocket events (async_tcp), read by loop(). id is set
+  // last and cleared first, so loop() never sees a half-set slot.
+  struct Client {
+    volatile uint32_t id; // 0 = free
+    volatile uint32_t periodUs;
+    uint32_t nextUs; // micros() when the next tick is due
+    uint32_t seq;
+  };
+
+  AsyncWebSocket _ws;
+  Client _clients[TELEMETRY_MAX_CLIENTS];
+  Snapshot<FrameTelemetry> _frame;
+  unsigned long _lastCleanup;
+  uint32_t _sent;
+  uint32_t _dropped;
+
+  void onEvent(AsyncWebSocketClient *client, AwsEventType type, void *arg,
+               uint8_t *data, size_t len);
+  void setRate(Client &c, long hz);
+  size_t build(char *out, size_t size);
+};
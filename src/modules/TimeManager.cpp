@@ -5,25 +5,36 @@
 #include <sys/time.h>
 #include <time.h>
 
+#define VALID_EPOCH 1577836800 // 2020-01-01 00:00:00 UTC
+
+// Bumped from the SNTP callback; capture() notices the change
+static volatile uint32_t s_ntpSyncCount = 0;
+static volatile unsigned long s_ntpSyncMs = 0;
+
 void timeAvailable(struct timeval *t) {
+  s_ntpSyncMs = max(millis(), 1UL);
+  s_ntpSyncCount++;
   Serial.println("Got time adjustment from NTP!");
 }
 
 TimeManager::TimeManager(Config &config)
-    : _config(config), _rtcFound(false), _isUTC(false), _lastRTCUpdate(0) {}
+    : _config(config), _rtcFound(false), _isUTC(false), _lastRTCUpdate(0),
+      _source(TimeSource::None), _ntpSyncSeen(0), _ntpServer() {}
 
+// Frame loop only (reads Config::view())
 void TimeManager::setUseNTP(bool enabled) {
   // Only act if state changes or if force re-init is needed (simplified here)
   if (enabled) {
-    String server = _config.getNTP();
-    if (server.length() == 0) {
-      server = "time.google.com"; // Fallback
-    }
-    Serial.printf("Enabling NTP with server: '%s'\r\n", server.c_str());
+    // SNTP keeps the pointer, so the name is copied out of the view
+    strlcpy(_ntpServer, _config.view().ntp, sizeof(_ntpServer));
+    if (!*_ntpServer)
+      strlcpy(_ntpServer, "time.google.com", sizeof(_ntpServer)); // Fallback
+    const char *server = _ntpServer;
+    Serial.printf("Enabling NTP with server: '%s'\r\n", server);
 
     // Check if we can resolve the hostname
     IPAddress ntpIP;
-    if (WiFi.hostByName(server.c_str(), ntpIP)) {
+    if (WiFi.hostByName(server, ntpIP)) {
       Serial.print("DNS Lookup Success. NTP IP: ");
       Serial.println(ntpIP);
     } else {
@@ -31,12 +42,8 @@ void TimeManager::setUseNTP(bool enabled) {
     }
 
     // Log the exact TZ string being used - CRITICAL for debugging
-    String tz = _config.getTimezone();
-    if (tz.isEmpty()) {
-      tz = "CST6CDT,M3.2.0,M11.1.0"; // Fallback to Chicago
-    }
     Serial.printf("Configuring Time with TZ: '%s' and Server: '%s'\r\n",
-                  tz.c_str(), server.c_str());
+                  configuredZone(), server);
 
     if (sntp_enabled()) {
       sntp_stop();
@@ -45,15 +52,13 @@ void TimeManager::setUseNTP(bool enabled) {
 
     // Manual Init Sequence to ensure reliable start
     sntp_setservername(0, "time.google.com");
-    if (server != "time.google.com") {
-      sntp_setservername(1, server.c_str());
+    if (strcmp(server, "time.google.com") != 0) {
+      sntp_setservername(1, server);
     }
     sntp_set_time_sync_notification_cb(timeAvailable);
     sntp_init();
 
-    // Manually apply timezone
-    setenv("TZ", tz.c_str(), 1);
-    tzset();
+    // The timezone itself is applied by the frame loop (applyTimezone())
 
     Serial.println("NTP Initialized via Manual Sequence (Google Primary). "
                    "Waiting for sync...\r\n");
@@ -70,18 +75,41 @@ void TimeManager::setOverrideUTC(bool enabled) {
     _isUTC = enabled;
     if (_isUTC) {
       Serial.println("Switching to UTC\r\n");
-      configTzTime("UTC0", _config.getNTP().c_str());
+      setZone("UTC0");
     } else {
       Serial.println("Switching to Local Time\r\n");
-      configTzTime(_config.getTimezone().c_str(), _config.getNTP().c_str());
+      setZone(configuredZone());
     }
   }
 }
 
+void TimeManager::applyTimezone() {
+  if (!_isUTC)
+    setZone(configuredZone());
+}
+
+// Frame loop only (reads Config::view())
+const char *TimeManager::configuredZone() {
+  const char *tz = _config.view().tz;
+  if (!*tz)
+    tz = "CST6CDT,M3.2.0,M11.1.0"; // Fallback to Chicago
+  return tz;
+}
+
+// Only touches the C library when the rules actually change; SNTP keeps
+// running as it is
+void TimeManager::setZone(const char *tz) {
+  if (_zone == tz)
+    return;
+  _zone = tz;
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
 void TimeManager::begin() {
   sntp_set_time_sync_notification_cb(timeAvailable);
   // Setup NTP if enabled
-  if (_config.getUseNTP()) {
+  if (_config.view().useNTP) {
     setUseNTP(true);
   } else {
     Serial.println("NTP Disabled by config\r\n");
@@ -107,25 +135,90 @@ void TimeManager::begin() {
 }
 
 void TimeManager::update() {
-  struct tm timeinfo;
-
-  // Debug logging removed
-
-  // Check if system time is valid (year > 2000)
+  // Check if system time is valid (year > 2020). Only the raw epoch is
+  // needed here, so skip the TZ conversion.
   // If we have valid NTP time (system time), we should update RTC periodically
-  if (getLocalTime(&timeinfo, 0)) {
-    if (timeinfo.tm_year > (2020 - 1900)) {
-      // We have valid time.
-      // Update RTC every hour
-      if (_lastRTCUpdate == 0 || millis() - _lastRTCUpdate > 3600000) {
-        syncRTCToSystem();
-        _lastRTCUpdate = millis();
-      }
-    } else {
-      // System time invalid (1970?), try fallback to RTC if we haven't already
-      // (We did at boot, but maybe we should retry if network fails?)
+  time_t now;
+  time(&now);
+  if (now > VALID_EPOCH) {
+    // We have valid time.
+    // Update RTC every hour
+    if (_lastRTCUpdate == 0 || millis() - _lastRTCUpdate > 3600000) {
+      syncRTCToSystem();
+      _lastRTCUpdate = millis();
     }
+  } else {
+    // System time invalid (1970?), try fallback to RTC if we haven't already
+    // (We did at boot, but maybe we should retry if network fails?)
+  }
+}
+
+void TimeManager::setManualTime(time_t timestamp) {
+  struct timeval tv = {timestamp, 0};
+  settimeofday(&tv, NULL);
+  _source = TimeSource::Manual;
+}
+
+const TimeSnapshot &TimeManager::capture(int32_t aheadUs) {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  if (aheadUs > 0) {
+    int64_t us = (int64_t)tv.tv_usec + aheadUs;
+    tv.tv_sec += us / 1000000;
+    tv.tv_usec = us % 1000000;
+  }
+
+  uint32_t syncs = s_ntpSyncCount;
+  if (syncs != _ntpSyncSeen) {
+    _ntpSyncSeen = syncs;
+    _source = TimeSource::NTP;
+  }
+
+  _snap.utc = tv.tv_sec;
+  _snap.micros = tv.tv_usec;
+  localtime_r(&tv.tv_sec, &_snap.local);
+  _snap.valid = (_snap.local.tm_year > (2020 - 1900));
+  _snap.source = _source;
+
+  fillFractions(_snap);
+  return _snap;
+}
+
+void TimeManager::fillFractions(TimeSnapshot &t) {
+  t.second = t.local.tm_sec + t.micros / 1000000.0f;
+  t.minute = t.local.tm_min + t.second / 60.0f;
+  t.hour = t.local.tm_hour + t.minute / 60.0f;
+}
+
+TimeSnapshot TimeManager::project(int32_t offsetUs, bool wholeSeconds) const {
+  TimeSnapshot t = _snap;
+  if (!t.valid)
+    return t;
+
+  int64_t us = (int64_t)t.micros + offsetUs;
+  if (wholeSeconds)
+    us += 500000;
+  int32_t secs = (int32_t)(us / 1000000);
+  int32_t rem = (int32_t)(us % 1000000);
+  if (rem < 0) {
+    rem += 1000000;
+    secs--;
+  }
+  t.utc += secs;
+  t.micros = wholeSeconds ? 0 : rem;
+
+  // Carry within the day only; offsets are a few hundred ms at most, so a
+  // DST jump or date change is simply picked up by the next capture()
+  if (secs != 0) {
+    int32_t day = t.local.tm_hour * 3600 + t.local.tm_min * 60 +
+                  t.local.tm_sec + secs;
+    day = ((day % 86400) + 86400) % 86400;
+    t.local.tm_hour = day / 3600;
+    t.local.tm_min = (day / 60) % 60;
+    t.local.tm_sec = day % 60;
   }
+  fillFractions(t);
+  return t;
 }
 
 void TimeManager::syncSystemToRTC() {
@@ -137,6 +230,7 @@ void TimeManager::syncSystemToRTC() {
   if (now.year() > 2020) {
     struct timeval tv = {(time_t)now.unixtime(), 0};
     settimeofday(&tv, NULL);
+    _source = TimeSource::RTC;
     Serial.println("Synced system time from RTC\r\n");
   }
 }
@@ -153,53 +247,28 @@ void TimeManager::syncRTCToSystem() {
   }
 }
 
-int TimeManager::getHour() {
-  struct tm timeinfo;
-  if (getLocalTime(&timeinfo, 0)) {
-    if (_config.get12H()) {
-      int h = timeinfo.tm_hour % 12;
-      if (h == 0)
-        h = 12;
-      return h;
-    }
-    return timeinfo.tm_hour;
-  }
-  return 0; // Invalid
-}
+// Frame getters: read from the last capture() instead of converting again
+int TimeManager::getHour() { return getHour(_snap); }
 
-int TimeManager::getHour24() {
-  struct tm timeinfo;
-  if (getLocalTime(&timeinfo, 0)) {
-    // Serial.printf("TimeManager::getHour24: %d\n", timeinfo.tm_hour);
-    return timeinfo.tm_hour;
+int TimeManager::getHour(const TimeSnapshot &t) {
+  if (!t.valid)
+    return 0; // Invalid
+  if (_config.view().is12h) { // As the calibration table was built
+    int h = t.local.tm_hour % 12;
+    if (h == 0)
+      h = 12;
+    return h;
   }
-  return 0;
+  return t.local.tm_hour;
 }
 
-int TimeManager::getMinute() {
-  struct tm timeinfo;
-  if (getLocalTime(&timeinfo, 0))
-    return timeinfo.tm_min;
-  return 0;
-}
+int TimeManager::getHour24() { return _snap.valid ? _snap.local.tm_hour : 0; }
 
-int TimeManager::getSecond() {
-  struct tm timeinfo;
-  if (getLocalTime(&timeinfo, 0))
-    return timeinfo.tm_sec;
-  return 0;
-}
+int TimeManager::getMinute() { return _snap.valid ? _snap.local.tm_min : 0; }
 
-float TimeManager::getExactSecond() {
-  struct timeval tv;
-  if (gettimeofday(&tv, NULL) == 0) {
-    struct tm timeinfo;
-    if (localtime_r(&tv.tv_sec, &timeinfo)) {
-      return (float)timeinfo.tm_sec + (tv.tv_usec / 1000000.0f);
-    }
-  }
-  return 0.0f;
-}
+int TimeManager::getSecond() { return _snap.valid ? _snap.local.tm_sec : 0; }
+
+float TimeManager::getExactSecond() { return _snap.valid ? _snap.second : 0.0f; }
 
 String TimeManager::getFormattedTime() {
   struct tm timeinfo;
@@ -213,10 +282,7 @@ String TimeManager::getFormattedTime() {
   return "Time Not Set";
 }
 
-bool TimeManager::isTimeSet() {
-  struct tm timeinfo;
-  if (getLocalTime(&timeinfo, 0)) {
-    return (timeinfo.tm_year > (2020 - 1900));
-  }
-  return false;
-}
+bool TimeManager::isTimeSet() { return _snap.valid; }
+
+uint32_t TimeManager::getNtpSyncs() { return s_ntpSyncCount; }
+unsigned long TimeManager::getLastNtpSyncMs() { return s_ntpSyncMs; }
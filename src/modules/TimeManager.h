@@ -4,15 +4,44 @@
 #include <RTClib.h> // Ensure you have this lib
 #include <time.h>
 
+// Where the system clock was last set from
+enum class TimeSource : uint8_t { None, NTP, RTC, Manual };
+
+// One coherent reading of the clock. Captured once per frame so every
+// meter and the lighting see the same instant, even across a rollover.
+struct TimeSnapshot {
+  time_t utc = 0;      // Seconds since epoch
+  uint32_t micros = 0; // Microseconds into the current second
+  struct tm local = {}; // Broken-down local time (UTC when overridden)
+  float hour = 0;      // Fractional hour, 0-24
+  float minute = 0;    // Fractional minute, 0-60
+  float second = 0;    // Fractional second, 0-60
+  bool valid = false;  // System time has been set (year > 2020)
+  TimeSource source = TimeSource::None;
+};
+
 class TimeManager {
 public:
   TimeManager(Config &config);
   void begin();
   void update(); // Call in loop
   void setOverrideUTC(bool enabled);
+  void applyTimezone(); // After the Time settings changed
   void setUseNTP(bool enabled);
+  void setManualTime(time_t timestamp);
+
+  // Single TZ conversion per frame; the getters below read from it.
+  // aheadUs captures the time that far in the future (frame landing time).
+  const TimeSnapshot &capture(int32_t aheadUs = 0);
+  const TimeSnapshot &snapshot() const { return _snap; }
+
+  // The last capture moved by offsetUs (may be negative), for aiming a
+  // meter at the time its needle will actually get there. wholeSeconds
+  // rounds to the nearest second so ticking needles don't flip a frame late.
+  TimeSnapshot project(int32_t offsetUs, bool wholeSeconds) const;
 
   int getHour();
+  int getHour(const TimeSnapshot &t); // 12/24H as in Config::view()
   int getHour24();
   int getMinute();
   int getSecond();
@@ -20,13 +49,26 @@ public:
   String getFormattedTime();
   bool isTimeSet();
 
+  // Sync state for telemetry
+  bool hasRTC() const { return _rtcFound; }
+  static uint32_t getNtpSyncs();
+  static unsigned long getLastNtpSyncMs(); // millis(), 0 = never
+
 private:
   Config &_config;
   RTC_DS3231 _rtc;
   bool _rtcFound;
   bool _isUTC; // Track current state
   unsigned long _lastRTCUpdate;
+  TimeSource _source;
+  uint32_t _ntpSyncSeen;
+  TimeSnapshot _snap;
+  String _zone; // TZ rules in effect (tzset() parses them once)
+  char _ntpServer[sizeof(ConfigBlob::ntp)]; // Named to SNTP
 
+  const char *configuredZone();
+  void setZone(const char *tz);
+  static void fillFractions(TimeSnapshot &t);
   void syncRTCToSystem();
   void syncSystemToRTC();
 };
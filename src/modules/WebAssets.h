@@ -0,0 +1,621 @@
+// Generated by tools/embed_web.py from web/, do not edit.
+#pragma once
+#include <Arduino.h>
+
+struct WebAsset {
+  const char *name; // File name in web/
+  const char *type;
+  const uint8_t *data; // gzip
+  uint32_t size;
+  const char *etag; // Quoted, as sent
+};
+
+// style.css: 867 bytes gzipped
+static const uint8_t WEB_STYLE_CSS[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x56, 0x5b, 0x6f, 0x9b, 0x30,
+    0x14, 0x7e, 0xdf, 0xaf, 0xb0, 0x34, 0x4d, 0x6d, 0xa7, 0x50, 0x01, 0x29, 0x59, 0x06, 0xda, 0xf3,
+    0xb4, 0xe7, 0x5d, 0x5e, 0xa6, 0x3d, 0x18, 0x7c, 0x00, 0xab, 0xc6, 0x46, 0xc6, 0x34, 0xe9, 0xa6,
+    0xfe, 0xf7, 0x1d, 0x9b, 0x4b, 0x1c, 0xa0, 0xd3, 0x62, 0x25, 0x85, 0x83, 0xcf, 0xed, 0xfb, 0x3e,
+    0x1f, 0xfa, 0x9e, 0xfc, 0x21, 0xb9, 0x3a, 0x07, 0x1d, 0xff, 0xcd, 0x65, 0x95, 0xe2, 0xb5, 0x66,
+    0xa0, 0x03, 0x34, 0x65, 0xe4, 0xe5, 0x4d, 0xae, 0xd8, 0x33, 0x6e, 0x28, 0x95, 0x34, 0x41, 0x49,
+    0x1b, 0x2e, 0x9e, 0x53, 0x72, 0xf3, 0x15, 0x2a, 0x05, 0xe4, 0xfb, 0x97, 0x9b, 0x1d, 0xf9, 0x46,
+    0x6b, 0xd5, 0xd0, 0x1d, 0xf9, 0x0c, 0x12, 0x9e, 0xf0, 0xef, 0x0f, 0xd0, 0x8c, 0x4a, 0xbc, 0xe8,
+    0xa8, 0xec, 0x82, 0x0e, 0x34, 0x2f, 0x33, 0x92, 0xd3, 0xe2, 0xb1, 0xd2, 0xaa, 0x97, 0x2c, 0x28,
+    0x94, 0x50, 0x3a, 0x25, 0x6f, 0xa3, 0xd8, 0xae, 0x8c, 0x4c, 0xf7, 0x10, 0xda, 0x95, 0x91, 0x86,
+    0x9e, 0x83, 0x13, 0x67, 0xa6, 0x4e, 0xc9, 0x21, 0x0c, 0xdb, 0xb3, 0xb5, 0xe8, 0x8a, 0xcb, 0x94,
+    0x84, 0x84, 0xf6, 0x46, 0x65, 0xa4, 0xa5, 0x8c, 0xb9, 0x42, 0x63, 0xf7, 0xd8, 0x55, 0x86, 0xb5,
+    0x43, 0x4a, 0xa2, 0x83, 0x35, 0x08, 0x2e, 0x21, 0xa8, 0x81, 0x57, 0xb5, 0x41, 0xd3, 0xfd, 0xc1,
+    0x76, 0x51, 0x47, 0x3b, 0x52, 0xc7, 0xf8, 0xdd, 0x63, 0x2f, 0x53, 0xca, 0xd2, 0x7d, 0x32, 0x62,
+    0xe0, 0x6c, 0x02, 0x2a, 0x78, 0x85, 0x49, 0x0a, 0x90, 0x06, 0xb4, 0x73, 0xd9, 0x3b, 0x5c, 0x46,
+    0x2c, 0x8c, 0x51, 0x0d, 0x66, 0x6c, 0xcf, 0xa4, 0x53, 0x82, 0x33, 0xf2, 0x36, 0xfc, 0x50, 0x1e,
+    0x3e, 0xd0, 0x23, 0x9b, 0xeb, 0x99, 0x37, 0x45, 0x5e, 0xd5, 0x81, 0x51, 0x6d, 0x4a, 0xf6, 0xce,
+    0xf2, 0xf2, 0x86, 0x7a, 0xc9, 0x2f, 0xfe, 0x2e, 0x3d, 0x83, 0x42, 0x69, 0x6a, 0xb8, 0xc2, 0x1a,
+    0xa4, 0x92, 0xe0, 0xb6, 0xa7, 0xb5, 0x7a, 0x02, 0x8d, 0x4e, 0xab, 0x2d, 0x88, 0x24, 0x68, 0xdb,
+    0xa8, 0xdd, 0xc7, 0x65, 0xdb, 0x9b, 0x9f, 0xe6, 0xb9, 0x85, 0x4f, 0x37, 0x76, 0xe7, 0xcd, 0xaf,
+    0x1d, 0xf1, 0x6d, 0x2d, 0xed, 0xba, 0x13, 0x36, 0xb2, 0xb4, 0xcb, 0xbe, 0xc9, 0x41, 0x2f, 0xad,
+    0xae, 0xc0, 0xa5, 0x91, 0x51, 0x03, 0x86, 0x37, 0x10, 0x08, 0x55, 0x50, 0x61, 0x9f, 0x76, 0x20,
+    0xa0, 0x30, 0x58, 0xdb, 0x48, 0x56, 0x14, 0x86, 0xef, 0x3c, 0x6e, 0xa2, 0xd8, 0xa7, 0xee, 0x88,
+    0xb8, 0x21, 0xb7, 0xaf, 0xa9, 0x6c, 0x45, 0xe1, 0x86, 0x5e, 0x62, 0x66, 0x57, 0xe6, 0x93, 0x97,
+    0x8d, 0x41, 0xd0, 0xeb, 0xc2, 0x4b, 0x92, 0x24, 0x93, 0x3d, 0xd0, 0x94, 0xf1, 0xbe, 0x4b, 0xc9,
+    0xc3, 0x00, 0xff, 0x46, 0x97, 0x58, 0xff, 0xa4, 0x94, 0xc4, 0x91, 0x74, 0x11, 0xd7, 0xda, 0xa7,
+    0xeb, 0xf3, 0x86, 0x3b, 0x74, 0xf3, 0x1e, 0xa9, 0x96, 0x3b, 0x72, 0x9f, 0x1b, 0x69, 0x55, 0xb2,
+    0x2e, 0xf7, 0x42, 0xef, 0x52, 0xf0, 0xae, 0xd9, 0xd3, 0x98, 0x34, 0x57, 0x82, 0xf9, 0xa8, 0x61,
+    0xa5, 0xa3, 0xac, 0x57, 0xd0, 0x0d, 0x9d, 0x0e, 0xda, 0x28, 0x7a, 0xdd, 0xd9, 0xa0, 0xad, 0xe2,
+    0x83, 0x5c, 0xaf, 0x48, 0x58, 0xc3, 0xb9, 0x01, 0x07, 0xe3, 0x5d, 0x2b, 0x28, 0x1e, 0xe6, 0x1c,
+    0x29, 0x7d, 0x7c, 0xed, 0x10, 0x6c, 0xb5, 0x3f, 0xa8, 0x72, 0x02, 0x61, 0xba, 0xb3, 0x50, 0xcc,
+    0x7a, 0x7d, 0x15, 0x10, 0x76, 0xfc, 0x87, 0xde, 0x6d, 0x88, 0x00, 0x87, 0x47, 0xe5, 0xe2, 0x0d,
+    0x17, 0xdb, 0xc1, 0xa0, 0x4c, 0xf6, 0x49, 0x38, 0x63, 0x7b, 0xaa, 0xb9, 0x59, 0x46, 0x98, 0xeb,
+    0xf2, 0x6f, 0xb7, 0xa3, 0xb1, 0x7d, 0x5c, 0xc6, 0xa5, 0xf3, 0x2f, 0xa8, 0x66, 0xdb, 0x9b, 0x22,
+    0xb0, 0x6b, 0x35, 0x7d, 0x16, 0xd0, 0x1e, 0x07, 0x1b, 0xca, 0xbc, 0xa6, 0x4c, 0x9d, 0xec, 0xd0,
+    0xb2, 0x94, 0x22, 0x0b, 0x44, 0x57, 0x39, 0xbd, 0x0d, 0x77, 0x6e, 0xdd, 0xef, 0xef, 0xe6, 0x09,
+    0x31, 0xcf, 0x96, 0x71, 0x48, 0x08, 0x9a, 0x83, 0xc0, 0x1a, 0x96, 0x04, 0xf9, 0x03, 0x25, 0x4a,
+    0xe6, 0xc9, 0x77, 0xad, 0xa4, 0xa9, 0xda, 0x3c, 0xcc, 0xa1, 0x48, 0x5c, 0x4b, 0x5c, 0x96, 0x6a,
+    0xbb, 0xa5, 0xf8, 0xb0, 0x8f, 0xf7, 0x47, 0x5f, 0x7e, 0x89, 0xd7, 0x92, 0x80, 0xd2, 0x38, 0xad,
+    0xac, 0x27, 0xde, 0xa4, 0x4d, 0xbb, 0xdf, 0x8a, 0xd3, 0x17, 0xdc, 0xc3, 0x06, 0x2a, 0x03, 0x08,
+    0x0f, 0xc3, 0x66, 0x2c, 0xa9, 0xeb, 0x8b, 0x02, 0xba, 0xce, 0x9b, 0x86, 0x87, 0x43, 0x9e, 0x1f,
+    0x28, 0x3e, 0x24, 0xf7, 0xa0, 0xb5, 0xd2, 0xde, 0xa3, 0x89, 0x6b, 0xeb, 0x87, 0x75, 0x60, 0xd8,
+    0x02, 0xd3, 0x51, 0x9c, 0x7d, 0xda, 0x47, 0xa9, 0x14, 0x80, 0x89, 0x9d, 0x80, 0x03, 0x54, 0x43,
+    0xd3, 0x5d, 0x64, 0x5c, 0xd1, 0x76, 0x9a, 0xca, 0x5b, 0x41, 0x7c, 0x8d, 0x6b, 0x2b, 0x16, 0x37,
+    0x16, 0x6c, 0x3c, 0xf4, 0xc2, 0x90, 0x85, 0x8d, 0xb3, 0x71, 0xb0, 0x2f, 0xb1, 0x9e, 0xa8, 0xe8,
+    0x01, 0x7d, 0x1a, 0xe4, 0x67, 0x3c, 0x89, 0xc3, 0x34, 0xf1, 0x0f, 0x95, 0xb6, 0x3c, 0xfd, 0x93,
+    0xb4, 0xab, 0xd0, 0x16, 0x3b, 0x15, 0x58, 0xc6, 0x5a, 0x1b, 0x79, 0x42, 0x3c, 0x1c, 0x40, 0x5c,
+    0xb4, 0xed, 0x3a, 0x9c, 0x04, 0x74, 0xe5, 0x3a, 0xa9, 0x69, 0x7e, 0x89, 0x2e, 0x2a, 0x90, 0x4a,
+    0x37, 0x54, 0x6c, 0x4c, 0x94, 0xff, 0x06, 0xd6, 0x69, 0x66, 0xf9, 0x16, 0x77, 0x47, 0x49, 0x60,
+    0x0d, 0x9c, 0xf9, 0x24, 0xd9, 0xfb, 0xcc, 0xfd, 0x06, 0x18, 0x09, 0x6d, 0x06, 0x2c, 0xb0, 0x7d,
+    0x23, 0x31, 0xaa, 0x86, 0x16, 0xa8, 0xb9, 0xb5, 0x2f, 0xf9, 0xa0, 0xe4, 0x42, 0xec, 0x2c, 0x9e,
+    0xf8, 0xef, 0xc0, 0xed, 0x47, 0x6c, 0x6c, 0x47, 0xa2, 0x52, 0xdf, 0xdd, 0x8d, 0x39, 0xc3, 0x0b,
+    0x9d, 0x73, 0x9a, 0xeb, 0x4e, 0x87, 0x73, 0x92, 0xac, 0x87, 0xb8, 0x03, 0xc7, 0x31, 0xfc, 0x2a,
+    0xb1, 0x23, 0x85, 0x03, 0x9e, 0xd3, 0xeb, 0x61, 0x42, 0xf7, 0x2f, 0xd3, 0x32, 0x4d, 0x4c, 0x2e,
+    0x09, 0x00, 0x00,
+};
+
+// calibration.html: 1857 bytes gzipped
+static const uint8_t WEB_CALIBRATION_HTML[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x57, 0xdb, 0x92, 0xdb, 0x36,
+    0x12, 0x7d, 0xd7, 0x57, 0xb4, 0xe7, 0x61, 0x41, 0x65, 0x64, 0x52, 0x9a, 0x71, 0x9c, 0x58, 0xb7,
+    0x54, 0x62, 0x3b, 0x95, 0xa4, 0x32, 0x6b, 0x57, 0xc6, 0x5b, 0xfb, 0xa0, 0x4c, 0x6d, 0x41, 0x24,
+    0x34, 0xe4, 0x8a, 0xb7, 0x00, 0xa0, 0x2e, 0xe5, 0x9a, 0x7f, 0xdf, 0xd3, 0x00, 0x29, 0x51, 0xb6,
+    0xb3, 0xd9, 0xda, 0x87, 0x19, 0x91, 0x40, 0xa3, 0x2f, 0xa7, 0x4f, 0x37, 0x9a, 0xf3, 0xd4, 0x16,
+    0xf9, 0x72, 0x9e, 0x2a, 0x99, 0x2c, 0xe7, 0x85, 0xb2, 0x92, 0x4a, 0x59, 0xa8, 0x85, 0xd8, 0x65,
+    0x6a, 0x5f, 0x57, 0xda, 0x0a, 0x8a, 0xab, 0xd2, 0xaa, 0xd2, 0x2e, 0xc4, 0x3e, 0x4b, 0x6c, 0xba,
+    0x48, 0xd4, 0x2e, 0x8b, 0xd5, 0x73, 0xf7, 0x32, 0xa2, 0xac, 0xcc, 0x6c, 0x26, 0xf3, 0xe7, 0x26,
+    0x96, 0xb9, 0x5a, 0x4c, 0xc4, 0x72, 0x30, 0xcf, 0xb3, 0x72, 0x4b, 0x5a, 0xe5, 0x0b, 0x61, 0xec,
+    0x31, 0x57, 0x26, 0x55, 0x0a, 0x5a, 0x52, 0xad, 0x36, 0x0b, 0x11, 0xb9, 0xa5, 0x30, 0x36, 0xe6,
+    0xbb, 0xdd, 0xe2, 0x56, 0xbd, 0x8a, 0x5f, 0xa8, 0x17, 0xe3, 0x9b, 0x57, 0xea, 0x66, 0xfc, 0xed,
+    0xe4, 0x15, 0x1f, 0x36, 0xb1, 0xce, 0x6a, 0xbb, 0x1c, 0xec, 0xa4, 0x26, 0xa8, 0xa4, 0x05, 0x7d,
+    0x7c, 0x9a, 0xb9, 0x37, 0xf8, 0xa6, 0xb4, 0xc1, 0xc2, 0x6a, 0x25, 0x52, 0x31, 0x22, 0xf1, 0x53,
+    0xd5, 0x68, 0xba, 0xe3, 0x55, 0xf1, 0x30, 0xa2, 0x95, 0x28, 0x78, 0xf1, 0x2e, 0x2b, 0x1b, 0xab,
+    0xfa, 0xcb, 0x86, 0x97, 0xef, 0x15, 0xa2, 0x48, 0xba, 0xe5, 0x87, 0xd9, 0x20, 0x8a, 0xe8, 0x7d,
+    0x95, 0x95, 0x16, 0xd1, 0x35, 0xa5, 0x35, 0x64, 0x53, 0x69, 0x29, 0x97, 0x90, 0x51, 0x3b, 0xa5,
+    0x8f, 0x54, 0xbb, 0xcd, 0xaa, 0x24, 0x49, 0x2e, 0x34, 0x2a, 0xa4, 0xde, 0x7a, 0xaf, 0xfc, 0x01,
+    0x38, 0x46, 0xe9, 0x94, 0x56, 0x37, 0x23, 0xba, 0x1d, 0xd1, 0x8b, 0x11, 0x7d, 0x3d, 0xa2, 0x6f,
+    0x46, 0x34, 0xb9, 0x85, 0xd1, 0xe2, 0x93, 0xf5, 0x97, 0x7e, 0x6b, 0xc2, 0xdb, 0xf8, 0xc3, 0xeb,
+    0x0d, 0x9e, 0x6f, 0xf1, 0xf7, 0x72, 0xf2, 0x40, 0x88, 0xcf, 0xeb, 0x0c, 0x59, 0x6b, 0xfb, 0x58,
+    0xcc, 0x06, 0x9b, 0xa6, 0x8c, 0x6d, 0x06, 0x17, 0x8c, 0xdc, 0xa9, 0xd7, 0x32, 0x0f, 0xe0, 0x59,
+    0x69, 0x87, 0xf4, 0x71, 0xe0, 0x1e, 0xc2, 0x5a, 0xbb, 0xdf, 0x37, 0x6a, 0x23, 0x9b, 0xdc, 0x06,
+    0x43, 0x0f, 0xd3, 0xa6, 0xd2, 0x05, 0xd4, 0x78, 0x11, 0x2b, 0xf5, 0xa3, 0xb2, 0x7e, 0x23, 0x91,
+    0xc8, 0xed, 0x82, 0x4a, 0xb5, 0xa7, 0x7f, 0xfc, 0xf6, 0xeb, 0xbd, 0x92, 0x3a, 0x4e, 0xdf, 0x4b,
+    0x2d, 0x0b, 0x13, 0xf0, 0xda, 0x8f, 0x38, 0xf7, 0x06, 0x22, 0x01, 0x2b, 0x18, 0x42, 0xd9, 0x46,
+    0xd9, 0x38, 0x75, 0x6f, 0xa1, 0x74, 0x7e, 0x8c, 0x10, 0x31, 0x92, 0x90, 0x56, 0xc9, 0xd4, 0x59,
+    0x09, 0xfd, 0xcb, 0x88, 0xd6, 0x55, 0x72, 0x9c, 0x7a, 0xfd, 0x4f, 0xc3, 0x41, 0x68, 0x53, 0x55,
+    0x06, 0x9a, 0x16, 0x4b, 0x78, 0x9a, 0x6d, 0x02, 0x1d, 0x56, 0x5b, 0x76, 0x1a, 0x20, 0x6a, 0x1b,
+    0x88, 0x7b, 0x04, 0x93, 0x3c, 0x13, 0xad, 0xb7, 0xf1, 0x1a, 0x2e, 0x25, 0x55, 0xdc, 0x14, 0xec,
+    0x2e, 0x7c, 0x7d, 0x9b, 0x2b, 0x7e, 0xfc, 0xe1, 0xf8, 0x73, 0x12, 0x08, 0x00, 0x7f, 0x57, 0x25,
+    0x8a, 0x85, 0xa1, 0x28, 0x5e, 0x87, 0x71, 0xaa, 0xe2, 0xad, 0x4a, 0xa0, 0x8e, 0xce, 0x6f, 0xd0,
+    0xb0, 0x91, 0xb9, 0x51, 0x33, 0xb2, 0xd5, 0xe3, 0x63, 0xce, 0x50, 0xf1, 0x29, 0xc8, 0x0f, 0x67,
+    0xf4, 0x34, 0x78, 0x22, 0x85, 0x4d, 0x9c, 0x68, 0x1d, 0x78, 0xab, 0x75, 0xa5, 0xa7, 0x24, 0xe8,
+    0x9a, 0x74, 0x68, 0xac, 0xb4, 0x8d, 0xf9, 0xa0, 0x0e, 0xd6, 0xcb, 0xc2, 0xfd, 0x58, 0x72, 0xdc,
+    0x8a, 0xfd, 0xff, 0xfc, 0x84, 0x62, 0x64, 0xb4, 0xb2, 0x8d, 0x2e, 0x5b, 0xa3, 0x83, 0xa7, 0x73,
+    0xa2, 0x3e, 0xb3, 0x8f, 0xb0, 0x5d, 0x4e, 0x92, 0x16, 0xf8, 0x13, 0xc8, 0x8c, 0x6f, 0x12, 0xca,
+    0xba, 0x56, 0x25, 0xe2, 0x64, 0x7c, 0x77, 0x0a, 0x3c, 0xed, 0x05, 0xf5, 0x1d, 0x89, 0x89, 0x20,
+    0x58, 0x1d, 0x8b, 0x53, 0x32, 0x44, 0x24, 0xeb, 0x2c, 0x02, 0x2a, 0xd9, 0x5a, 0x4b, 0xb6, 0x18,
+    0x15, 0x0c, 0x4f, 0x3f, 0x31, 0xe2, 0xfd, 0xbb, 0xfb, 0x0f, 0xa2, 0xcb, 0x09, 0x0c, 0x3f, 0xe1,
+    0xf4, 0x7f, 0x03, 0xf8, 0x35, 0xaa, 0x5b, 0x57, 0xb9, 0x11, 0xc3, 0xd0, 0xd7, 0x66, 0x55, 0xcb,
+    0x38, 0xb3, 0x47, 0xa6, 0xe2, 0x97, 0xbc, 0x09, 0xbf, 0x16, 0x1c, 0x33, 0xd7, 0x0f, 0xf8, 0x87,
+    0x26, 0x41, 0x15, 0x0a, 0x86, 0xa2, 0xbd, 0x89, 0x6a, 0xbf, 0x30, 0x45, 0xd9, 0xe4, 0x47, 0x54,
+    0x94, 0xe2, 0x98, 0x95, 0xb1, 0xb4, 0x93, 0x79, 0xa3, 0xa8, 0x86, 0x58, 0xa9, 0x54, 0x82, 0x62,
+    0x7a, 0xac, 0x94, 0xa1, 0xaa, 0xb1, 0x23, 0x92, 0x96, 0x55, 0x15, 0x95, 0xe1, 0x62, 0x8b, 0xbd,
+    0x90, 0x2c, 0xb3, 0xc2, 0x85, 0x47, 0x1b, 0xd0, 0x53, 0x11, 0x57, 0x65, 0x59, 0x59, 0xda, 0xa7,
+    0x19, 0xce, 0xb2, 0xde, 0x5c, 0x3a, 0x79, 0x45, 0x99, 0x21, 0x63, 0xb3, 0x3c, 0xa7, 0xb5, 0xca,
+    0xca, 0x47, 0x56, 0x65, 0x10, 0xdc, 0x88, 0x4c, 0xd5, 0xda, 0x77, 0xe6, 0x4a, 0xae, 0x69, 0xb2,
+    0x5a, 0x66, 0xb9, 0x41, 0x41, 0xaf, 0x65, 0xbc, 0xcd, 0xab, 0x47, 0xaa, 0x36, 0xb4, 0x55, 0x47,
+    0x83, 0xf0, 0xb7, 0xca, 0xb8, 0x44, 0xed, 0xcd, 0x88, 0x38, 0x25, 0xd0, 0xe5, 0x3a, 0x0f, 0x14,
+    0x01, 0x81, 0xa4, 0xc9, 0x7b, 0x2c, 0x3b, 0xa7, 0x7b, 0x6f, 0x00, 0x5e, 0xa9, 0x62, 0xd4, 0x1e,
+    0x12, 0xbd, 0x37, 0x6d, 0x92, 0xff, 0xa9, 0xd6, 0xf7, 0x15, 0x50, 0x03, 0x73, 0xf6, 0x66, 0x1a,
+    0x45, 0xcc, 0x9b, 0xbc, 0x8a, 0x5d, 0x44, 0x61, 0xca, 0x91, 0x5e, 0x93, 0xe8, 0xe1, 0xc5, 0xf9,
+    0xdd, 0x9b, 0xb0, 0x2a, 0x2b, 0x98, 0x86, 0x0e, 0x44, 0x90, 0xb4, 0xd8, 0xb6, 0x1b, 0x71, 0x5e,
+    0x81, 0xc1, 0x70, 0xa0, 0xb5, 0xcc, 0xf6, 0x20, 0x66, 0x3f, 0x64, 0x85, 0x02, 0x8a, 0xc1, 0xc9,
+    0x11, 0x34, 0x97, 0xf1, 0x78, 0xcc, 0x54, 0xbe, 0xe0, 0x65, 0x6b, 0x88, 0x7b, 0x48, 0x96, 0x1c,
+    0x46, 0x9c, 0x8f, 0xa1, 0x2f, 0xce, 0x67, 0x7f, 0x5d, 0x7b, 0xe7, 0xa2, 0xf3, 0xbc, 0x9f, 0x0d,
+    0x5a, 0x84, 0x56, 0xd0, 0xf5, 0x00, 0xaf, 0xae, 0xa1, 0xce, 0x15, 0xe8, 0xb3, 0x13, 0x58, 0xce,
+    0xbf, 0x1e, 0x72, 0x56, 0x37, 0x28, 0x4f, 0xad, 0xfe, 0x68, 0x40, 0x87, 0xef, 0xbb, 0xf4, 0xfe,
+    0xc8, 0xd9, 0x0d, 0x7a, 0xe1, 0xfa, 0x1a, 0xec, 0x35, 0xbe, 0xf3, 0x96, 0x83, 0xf8, 0x0b, 0xc9,
+    0x80, 0x59, 0x40, 0xa4, 0x71, 0x7b, 0x1d, 0xef, 0x51, 0xcb, 0x8a, 0x9e, 0x2d, 0x68, 0x72, 0x72,
+    0x95, 0x40, 0x88, 0x7b, 0x55, 0xb6, 0xdc, 0x8a, 0x3d, 0x48, 0x2a, 0x69, 0x4f, 0xad, 0x9b, 0xcd,
+    0x46, 0x69, 0x95, 0x7c, 0x5f, 0x70, 0xcf, 0xa5, 0x25, 0x8d, 0xff, 0x7f, 0xbf, 0x3b, 0x83, 0xf0,
+    0xbe, 0xd2, 0x01, 0x73, 0x09, 0xe8, 0xe0, 0x76, 0xec, 0xe8, 0x34, 0x04, 0x5b, 0x42, 0x3e, 0x12,
+    0xfc, 0x72, 0xff, 0xee, 0xef, 0x28, 0x35, 0x8d, 0xc5, 0x6c, 0x73, 0x0c, 0x3e, 0xf2, 0x35, 0x37,
+    0xa5, 0xeb, 0x2e, 0x31, 0x8d, 0x9a, 0xd2, 0x05, 0xc0, 0x4f, 0xdc, 0x72, 0xfa, 0xa4, 0xe4, 0xd4,
+    0xf6, 0xa8, 0xe7, 0xee, 0xb2, 0xdf, 0x94, 0x91, 0x45, 0xdd, 0x56, 0x47, 0xdc, 0x68, 0xcd, 0x41,
+    0xe3, 0x77, 0xa7, 0x50, 0x35, 0x60, 0x15, 0x2f, 0xd7, 0xe7, 0xfb, 0x8e, 0xe2, 0x54, 0x96, 0x8f,
+    0x20, 0x7d, 0x0f, 0x6a, 0xfb, 0x9a, 0x77, 0x82, 0xed, 0x88, 0xca, 0xae, 0x6f, 0xd5, 0xdc, 0x04,
+    0x64, 0xbe, 0xda, 0xe2, 0x4e, 0x03, 0xcf, 0xf8, 0xee, 0xc5, 0xd5, 0x89, 0x00, 0xc9, 0x47, 0x88,
+    0x85, 0xf1, 0x0c, 0x3f, 0x73, 0x42, 0xe4, 0xd9, 0xf5, 0x75, 0x77, 0xee, 0x80, 0x8d, 0x8c, 0xbe,
+    0xa2, 0xa0, 0x0e, 0x73, 0x55, 0x3e, 0xda, 0x94, 0x9e, 0x73, 0x52, 0x22, 0x0a, 0x4a, 0xf7, 0x84,
+    0xb2, 0x87, 0xc4, 0x9d, 0xb4, 0x69, 0xb8, 0xc9, 0x2b, 0xe0, 0x75, 0x68, 0xaf, 0x83, 0x75, 0xb7,
+    0x5c, 0x64, 0x65, 0x20, 0x51, 0x27, 0xb8, 0x22, 0x2f, 0x74, 0xcc, 0x06, 0xf0, 0x23, 0xac, 0x1b,
+    0x93, 0x06, 0x4e, 0x4e, 0xc3, 0xe7, 0x24, 0xa8, 0x57, 0xf2, 0x01, 0xc2, 0xf8, 0x5d, 0x3f, 0x40,
+    0x8c, 0x5f, 0x87, 0x6c, 0xfe, 0x80, 0x17, 0x39, 0x64, 0xfc, 0x9e, 0x06, 0x3e, 0x0e, 0xe8, 0x87,
+    0x02, 0x4e, 0x57, 0x99, 0x28, 0xed, 0xc6, 0x81, 0x60, 0x3b, 0xbc, 0x28, 0x96, 0xcb, 0xad, 0x36,
+    0x22, 0x4e, 0xe6, 0x82, 0x44, 0x5a, 0x18, 0x11, 0x66, 0xd8, 0x3f, 0xbc, 0xdb, 0x60, 0x73, 0xd4,
+    0x43, 0xc8, 0x07, 0x60, 0x6a, 0xc9, 0x25, 0xbc, 0xa5, 0x05, 0x4b, 0x0b, 0xf4, 0xcd, 0x00, 0xdb,
+    0x61, 0x3a, 0xb9, 0xc1, 0x23, 0xfe, 0x4d, 0xe9, 0xe6, 0xc5, 0x10, 0xff, 0x5f, 0x8e, 0x5b, 0x79,
+    0xc5, 0x23, 0xce, 0xd5, 0x3c, 0x97, 0x6b, 0x95, 0x2f, 0xdd, 0x44, 0x62, 0xe6, 0x91, 0x7f, 0x9b,
+    0x63, 0x13, 0x19, 0x6e, 0xe7, 0xb1, 0x2b, 0x04, 0xb8, 0xc5, 0xdf, 0x55, 0x29, 0x98, 0xcd, 0x2e,
+    0x7f, 0x98, 0xb0, 0xba, 0xb4, 0xfd, 0x7e, 0x75, 0x12, 0xf8, 0xfd, 0x6a, 0x44, 0xd7, 0x36, 0xcd,
+    0x4c, 0xe8, 0xe8, 0x34, 0x14, 0xcb, 0xab, 0x6e, 0xc2, 0x80, 0x9f, 0x21, 0xd2, 0xf7, 0x56, 0xf2,
+    0xcd, 0xde, 0x35, 0x93, 0xd2, 0x77, 0x93, 0x9c, 0xae, 0xd9, 0x93, 0xaa, 0xe6, 0x45, 0x56, 0x86,
+    0x64, 0x21, 0x8a, 0x13, 0xfc, 0xb8, 0x02, 0xc8, 0x7b, 0xa4, 0x12, 0x77, 0x15, 0x88, 0x21, 0x37,
+    0xb2, 0x25, 0xb7, 0xb7, 0x92, 0x9f, 0xe6, 0x91, 0x3f, 0xbb, 0x14, 0x33, 0x77, 0xeb, 0x70, 0x7c,
+    0xa9, 0xeb, 0x67, 0x39, 0xbb, 0x35, 0x8f, 0xfc, 0xe9, 0xe5, 0x3c, 0xc9, 0x76, 0x14, 0xa3, 0x85,
+    0x9b, 0x05, 0x77, 0x99, 0xe7, 0x8f, 0x3a, 0x4b, 0x9c, 0x8f, 0x5f, 0x22, 0x56, 0x67, 0xfe, 0x82,
+    0x5f, 0x3c, 0x8b, 0x75, 0x4c, 0xf1, 0x0c, 0x60, 0xb6, 0x39, 0xec, 0xa3, 0x4f, 0x49, 0xf7, 0x15,
+    0x5a, 0x22, 0x53, 0x6f, 0x02, 0xc4, 0x53, 0x1f, 0x22, 0xec, 0x2f, 0x5b, 0xc4, 0x39, 0x4e, 0xa7,
+    0xcd, 0x39, 0xd8, 0xe2, 0x9e, 0x95, 0x35, 0xc8, 0x6e, 0x8f, 0x35, 0x00, 0x2e, 0x9b, 0x62, 0x8d,
+    0x91, 0x91, 0x40, 0xc8, 0x05, 0xae, 0x62, 0x08, 0x1f, 0x16, 0x62, 0x32, 0xbe, 0xb9, 0x15, 0x9f,
+    0xe4, 0x25, 0x63, 0x15, 0xc2, 0x57, 0xb0, 0x5f, 0xad, 0x57, 0xd9, 0x83, 0x5f, 0xac, 0xca, 0x0d,
+    0xda, 0x2c, 0xc2, 0xed, 0x35, 0x62, 0x96, 0x60, 0x56, 0x41, 0x60, 0x44, 0xfd, 0x6c, 0x41, 0xda,
+    0x39, 0xe0, 0xc0, 0x09, 0x4f, 0x59, 0x5d, 0x5d, 0x75, 0x46, 0x5c, 0xcf, 0x3d, 0x9f, 0x98, 0xd1,
+    0xff, 0xa2, 0x75, 0x39, 0x8f, 0x38, 0xec, 0x2b, 0xa6, 0xfa, 0x9f, 0xf5, 0x7c, 0xb6, 0x23, 0xde,
+    0x5b, 0x1e, 0x05, 0x32, 0x34, 0x17, 0xfd, 0xd3, 0x87, 0xbb, 0x5f, 0x61, 0x2b, 0xf5, 0xc9, 0xe5,
+    0xe3, 0xee, 0xea, 0xff, 0x93, 0x59, 0x04, 0xa7, 0xce, 0x93, 0x9f, 0x0e, 0xff, 0x6d, 0xf8, 0x9e,
+    0x6a, 0xd7, 0x12, 0x3f, 0x0d, 0xfa, 0x81, 0x3e, 0x99, 0xb5, 0xb3, 0xfc, 0xe7, 0x54, 0x2c, 0x98,
+    0x8a, 0xfd, 0x02, 0x2c, 0x56, 0xe3, 0x87, 0xe1, 0xec, 0x2f, 0x87, 0x98, 0xcb, 0x9b, 0x8a, 0x6d,
+    0x84, 0x7e, 0xa6, 0x82, 0xbf, 0x38, 0x0a, 0xea, 0xb5, 0x9f, 0x15, 0xf3, 0xc8, 0x7f, 0xe8, 0xf0,
+    0x78, 0x84, 0xb7, 0x74, 0xb2, 0x74, 0x76, 0xe8, 0xf5, 0x39, 0x0e, 0x88, 0x4c, 0xb0, 0x75, 0x41,
+    0x52, 0x9d, 0xb8, 0x0f, 0x1b, 0xa6, 0x47, 0xb7, 0x68, 0xf6, 0x19, 0x60, 0x10, 0x97, 0x6c, 0x71,
+    0x0e, 0xac, 0xab, 0x83, 0x40, 0x12, 0x16, 0x27, 0xc7, 0x7a, 0xf5, 0x7a, 0x39, 0x21, 0x72, 0x82,
+    0x90, 0x1a, 0x7a, 0x5b, 0xca, 0x35, 0x7a, 0x77, 0xcf, 0x09, 0xe2, 0xfd, 0x8e, 0x90, 0x83, 0x79,
+    0x7d, 0xb2, 0x5a, 0xc8, 0x3c, 0x17, 0xcb, 0xf6, 0x00, 0x9f, 0xc7, 0xd0, 0x89, 0x11, 0xa8, 0xaa,
+    0x7d, 0xe7, 0xc7, 0x9c, 0xb1, 0x75, 0xf3, 0x12, 0x1a, 0x43, 0xf7, 0xc5, 0x04, 0x01, 0x75, 0x00,
+    0x1c, 0x9e, 0x9b, 0x26, 0x9c, 0x47, 0x35, 0x03, 0xc1, 0xf9, 0x1c, 0xcc, 0xdd, 0xe7, 0x82, 0x9f,
+    0xef, 0xf9, 0xeb, 0x0c, 0xc3, 0xf9, 0xbf, 0xfa, 0x39, 0x6d, 0xe7, 0xca, 0x85, 0x1f, 0x2b, 0xbb,
+    0xa8, 0x4e, 0x33, 0x23, 0x22, 0x33, 0xcd, 0xba, 0xc8, 0x40, 0xd6, 0x76, 0x28, 0xbe, 0xfc, 0x56,
+    0x61, 0xd4, 0xd2, 0xdb, 0xe5, 0xf9, 0x4b, 0x0d, 0xe0, 0xde, 0xfa, 0x06, 0xc0, 0xaa, 0x52, 0x26,
+    0xdb, 0xb2, 0x73, 0x05, 0x3b, 0xfd, 0xaf, 0xb7, 0x4b, 0xd1, 0xe2, 0x53, 0xd1, 0xfe, 0x17, 0xdd,
+    0xa5, 0xa8, 0xb9, 0x10, 0x5d, 0xeb, 0xcb, 0x14, 0x79, 0x7f, 0x4f, 0x85, 0xca, 0x9f, 0x23, 0x7d,
+    0xe0, 0xd9, 0xe3, 0x88, 0x41, 0xc1, 0xaf, 0xec, 0x3e, 0x5a, 0xc5, 0xf2, 0x6f, 0xb9, 0xd4, 0x7a,
+    0x46, 0x3f, 0x60, 0x72, 0x64, 0x3c, 0xdf, 0x48, 0x93, 0xae, 0x2b, 0xd0, 0x62, 0x1e, 0x49, 0x3e,
+    0xe0, 0xe8, 0x04, 0x2f, 0xf8, 0x53, 0x7a, 0xf0, 0x1f, 0x45, 0xc9, 0xa2, 0x17, 0x52, 0x0f, 0x00,
+    0x00,
+};
+
+// index.html: 423 bytes gzipped
+static const uint8_t WEB_INDEX_HTML[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x52, 0xcb, 0x6e, 0x1b, 0x31,
+    0x0c, 0xbc, 0xef, 0x57, 0xe8, 0xa6, 0x5d, 0x20, 0xd9, 0x87, 0x93, 0x43, 0x8d, 0xac, 0xb6, 0x40,
+    0xf3, 0x00, 0x02, 0xb8, 0xa7, 0x06, 0xc8, 0x59, 0x96, 0xb8, 0x16, 0x11, 0xad, 0x64, 0x48, 0xb4,
+    0x1d, 0xa3, 0xe8, 0xbf, 0x57, 0xb2, 0x9d, 0xa4, 0x0e, 0x9a, 0x1b, 0xc9, 0x99, 0xe1, 0x88, 0x22,
+    0x7b, 0x43, 0x93, 0x1d, 0x7a, 0x03, 0x52, 0x0f, 0xfd, 0x04, 0x24, 0x99, 0x93, 0x13, 0x08, 0xbe,
+    0x45, 0xd8, 0xad, 0x7d, 0x20, 0xce, 0x94, 0x77, 0x04, 0x8e, 0x04, 0xdf, 0xa1, 0x26, 0x23, 0x34,
+    0x6c, 0x51, 0xc1, 0xe5, 0x21, 0xb9, 0x60, 0xe8, 0x90, 0x50, 0xda, 0xcb, 0xa8, 0xa4, 0x05, 0xd1,
+    0xf1, 0xa1, 0xe8, 0x2d, 0xba, 0x17, 0x16, 0xc0, 0x0a, 0x1e, 0x69, 0x6f, 0x21, 0x1a, 0x80, 0xd4,
+    0xc5, 0x04, 0x18, 0x05, 0x6f, 0x0e, 0xa5, 0x5a, 0xc5, 0xf8, 0x7d, 0x2b, 0xae, 0x60, 0xae, 0xae,
+    0xe1, 0xba, 0x9d, 0xcd, 0x61, 0xd6, 0x7e, 0xeb, 0xe6, 0x59, 0xdc, 0x1c, 0x1f, 0xb2, 0xf4, 0x7a,
+    0x9f, 0x32, 0xd3, 0x0d, 0x3f, 0x81, 0x20, 0xb0, 0x5b, 0xeb, 0xd5, 0x0b, 0xbb, 0x93, 0xd1, 0x2c,
+    0xbd, 0x0c, 0x3a, 0xd1, 0xba, 0x0c, 0xcf, 0x18, 0x6a, 0xc1, 0x55, 0x06, 0xf9, 0xb0, 0xf0, 0x52,
+    0xa3, 0x5b, 0x31, 0xc2, 0x09, 0xea, 0xba, 0x4e, 0x9c, 0x59, 0xe2, 0xc8, 0x77, 0x67, 0x20, 0x4a,
+    0x70, 0x6c, 0x32, 0x9e, 0xa6, 0xb2, 0x32, 0x46, 0xc1, 0x97, 0xe4, 0xf8, 0xf0, 0x94, 0x2a, 0xec,
+    0xd7, 0x09, 0xef, 0x1b, 0xf9, 0x5f, 0x99, 0x05, 0x7d, 0xae, 0x5a, 0xdc, 0xdf, 0xb1, 0x05, 0xae,
+    0x4c, 0x86, 0x3f, 0x89, 0xd2, 0x67, 0xe0, 0x32, 0x48, 0x42, 0xef, 0xce, 0x35, 0xa7, 0x69, 0x3e,
+    0xe0, 0xaf, 0xdc, 0xe2, 0x3e, 0x12, 0x4c, 0xe7, 0xe2, 0x07, 0x0c, 0xd3, 0x4e, 0x06, 0xf8, 0xa4,
+    0xd9, 0xe1, 0x88, 0xe7, 0xc4, 0x67, 0x7c, 0x40, 0x76, 0xeb, 0xdd, 0x88, 0xab, 0xcd, 0xbf, 0x36,
+    0x51, 0x05, 0x5c, 0xd3, 0x50, 0x24, 0x97, 0xc7, 0xb4, 0xd3, 0xb0, 0x95, 0xb6, 0x1c, 0x37, 0x4e,
+    0x65, 0x46, 0x59, 0xb1, 0xdf, 0xc5, 0x08, 0xa4, 0x4c, 0xc9, 0x1b, 0xb9, 0xc6, 0xe3, 0x37, 0x55,
+    0x35, 0x19, 0x70, 0x65, 0x80, 0xb8, 0xf6, 0x2e, 0x02, 0x13, 0x03, 0x7b, 0x8b, 0x6b, 0x82, 0x57,
+    0x2a, 0xab, 0xaa, 0x38, 0x52, 0x32, 0x3d, 0xc3, 0xda, 0xab, 0xcd, 0x94, 0xce, 0xa5, 0x5e, 0x01,
+    0xdd, 0x5b, 0xc8, 0xe1, 0x8f, 0xfd, 0xa3, 0x2e, 0x4f, 0x5b, 0xaa, 0x6a, 0x74, 0x0e, 0xc2, 0x53,
+    0xd2, 0x32, 0x71, 0x58, 0x55, 0x6a, 0xa0, 0x64, 0xb6, 0x85, 0x10, 0x72, 0x83, 0x74, 0x6e, 0xd1,
+    0xa7, 0x1b, 0x49, 0xa9, 0x0f, 0xb9, 0x58, 0x55, 0x37, 0xc5, 0x9f, 0x0b, 0xd6, 0xb5, 0x6d, 0x9b,
+    0xa2, 0xbe, 0x79, 0x9b, 0xa2, 0x6f, 0x0e, 0x57, 0x92, 0xf6, 0x9c, 0x2f, 0xb8, 0xf8, 0x0b, 0x95,
+    0xa1, 0xc3, 0xa4, 0xc9, 0x02, 0x00, 0x00,
+};
+
+// led.html: 1798 bytes gzipped
+static const uint8_t WEB_LED_HTML[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x57, 0x6b, 0x6f, 0xdb, 0x46,
+    0x16, 0xfd, 0xae, 0x5f, 0x31, 0xd1, 0xa2, 0x19, 0x6a, 0x23, 0x53, 0x92, 0xdd, 0x2c, 0x1a, 0x4b,
+    0x62, 0x90, 0x87, 0x83, 0x4d, 0xe3, 0xb4, 0x41, 0xe4, 0x45, 0x77, 0xe1, 0x1a, 0xed, 0x90, 0x1c,
+    0x9a, 0x53, 0x53, 0xa4, 0x76, 0x66, 0x24, 0xc5, 0x70, 0xfd, 0xdf, 0x7b, 0xee, 0x0c, 0x49, 0x51,
+    0x8a, 0x93, 0x00, 0x0d, 0x02, 0xc8, 0x9c, 0xc7, 0xbd, 0xe7, 0xbe, 0xce, 0xbd, 0x33, 0xcb, 0xed,
+    0xb2, 0x88, 0x66, 0xb9, 0x14, 0x69, 0x34, 0x5b, 0x4a, 0x2b, 0x58, 0x29, 0x96, 0x72, 0xce, 0x37,
+    0x4a, 0x6e, 0x57, 0x95, 0xb6, 0x9c, 0x25, 0x55, 0x69, 0x65, 0x69, 0xe7, 0x7c, 0xab, 0x52, 0x9b,
+    0xcf, 0x53, 0xb9, 0x51, 0x89, 0x3c, 0x72, 0x1f, 0x43, 0xa6, 0x4a, 0x65, 0x95, 0x28, 0x8e, 0x4c,
+    0x22, 0x0a, 0x39, 0x9f, 0xf0, 0xa8, 0x37, 0x2b, 0x54, 0x79, 0xc3, 0xb4, 0x2c, 0xe6, 0xdc, 0xd8,
+    0xdb, 0x42, 0x9a, 0x5c, 0x4a, 0x48, 0xc9, 0xb5, 0xcc, 0xe6, 0x7c, 0xe4, 0x96, 0xc2, 0xc4, 0x98,
+    0xe7, 0x9b, 0xf9, 0x89, 0x7c, 0x96, 0x7c, 0x2f, 0xbf, 0x1f, 0x1f, 0x3f, 0x93, 0xc7, 0xe3, 0x1f,
+    0x26, 0xcf, 0xe8, 0xb2, 0x49, 0xb4, 0x5a, 0xd9, 0xa8, 0xb7, 0x11, 0x9a, 0xdd, 0xc8, 0x5b, 0xc3,
+    0xe6, 0xec, 0xf2, 0x6a, 0xea, 0x3e, 0xdf, 0xbf, 0xf8, 0xef, 0x6f, 0xef, 0xce, 0xfe, 0xb7, 0xc0,
+    0xd2, 0x64, 0xda, 0x1b, 0x8d, 0xd8, 0xb9, 0xda, 0x48, 0xb6, 0xd2, 0x92, 0xa0, 0xb2, 0x6a, 0x23,
+    0x35, 0x1b, 0x6d, 0xcd, 0xa8, 0x59, 0xd8, 0xe6, 0xaa, 0x90, 0x4c, 0x00, 0x7e, 0x51, 0x69, 0x86,
+    0xff, 0xb1, 0x56, 0xd7, 0xb9, 0x2d, 0xa5, 0x31, 0x4c, 0x19, 0x16, 0x4b, 0x55, 0x5e, 0x93, 0x94,
+    0x24, 0x17, 0xe5, 0xb5, 0x4c, 0x4f, 0x99, 0xcd, 0x25, 0x2b, 0xe5, 0x56, 0x1a, 0xcb, 0x8a, 0xaa,
+    0xba, 0x61, 0xd7, 0x95, 0x34, 0xac, 0x5a, 0x5b, 0x26, 0x2c, 0x5b, 0x56, 0x58, 0xad, 0xca, 0x04,
+    0xfa, 0xa0, 0x46, 0x94, 0x6a, 0x29, 0xac, 0xaa, 0x4a, 0x96, 0x69, 0x38, 0x2b, 0x64, 0x17, 0xb9,
+    0x74, 0xa2, 0x8a, 0x2a, 0xb9, 0x61, 0xa9, 0xae, 0x56, 0x50, 0x61, 0xd9, 0xc9, 0x98, 0x19, 0x26,
+    0x32, 0x8b, 0x1b, 0x24, 0xbb, 0x10, 0x90, 0xe1, 0xb5, 0x0d, 0x09, 0x0f, 0xae, 0x2f, 0x04, 0x2c,
+    0x58, 0x24, 0xb9, 0x4c, 0xd7, 0xf0, 0x8a, 0xb3, 0x72, 0x6b, 0x86, 0xd0, 0x51, 0xa6, 0x40, 0x07,
+    0x43, 0xcb, 0x75, 0x51, 0x0c, 0x99, 0xa9, 0x4f, 0xa4, 0x58, 0xc9, 0x44, 0x61, 0xe4, 0xb4, 0x97,
+    0xad, 0xcb, 0xc4, 0x21, 0xd8, 0x9a, 0x57, 0x55, 0x59, 0xca, 0xc4, 0x06, 0x03, 0x76, 0xd7, 0xdb,
+    0x92, 0xc3, 0x60, 0x04, 0xfb, 0x45, 0xc6, 0x0b, 0x80, 0x91, 0x36, 0xe0, 0x5b, 0x73, 0x3a, 0x1a,
+    0x71, 0xf6, 0x04, 0x56, 0x25, 0x0e, 0x75, 0x98, 0x93, 0x35, 0x4f, 0x18, 0xef, 0xb8, 0x8b, 0x0f,
+    0xa6, 0xb8, 0x1c, 0x56, 0x65, 0x05, 0xe5, 0x90, 0x61, 0x00, 0xe1, 0x83, 0xdf, 0xaa, 0x37, 0x60,
+    0x9c, 0x91, 0x04, 0xa0, 0xd6, 0x4c, 0xfa, 0x70, 0xcc, 0x5e, 0xa8, 0xa5, 0x84, 0x97, 0x82, 0x16,
+    0xc8, 0x90, 0x4d, 0xc6, 0xe3, 0xf1, 0x60, 0xca, 0xee, 0xa7, 0xbd, 0xfb, 0x1d, 0xd0, 0x5a, 0xd1,
+    0xb9, 0x4c, 0x03, 0x45, 0x50, 0x77, 0x46, 0xde, 0xf9, 0x18, 0x9d, 0xba, 0x80, 0x5f, 0xaa, 0xab,
+    0x30, 0x19, 0x76, 0x82, 0xb5, 0x5b, 0x8e, 0x49, 0xa2, 0xca, 0x82, 0x47, 0xad, 0x3f, 0x1c, 0x84,
+    0x8e, 0x73, 0xac, 0x5e, 0xcb, 0x29, 0x72, 0xef, 0xff, 0x6b, 0x44, 0xf1, 0x45, 0x13, 0xa5, 0x37,
+    0x14, 0xa4, 0xa0, 0x63, 0x11, 0x61, 0xeb, 0x42, 0xeb, 0x6c, 0x39, 0x2f, 0x3e, 0xe0, 0x6f, 0x52,
+    0xdb, 0x20, 0xfe, 0xf3, 0x4f, 0x78, 0x3d, 0xd4, 0xa8, 0x98, 0xdb, 0x85, 0x15, 0x56, 0xb2, 0x47,
+    0xc8, 0xc8, 0x01, 0xd4, 0xda, 0xb5, 0x2e, 0xa7, 0x0c, 0x89, 0xb0, 0x40, 0xbd, 0xf8, 0x74, 0x49,
+    0xbc, 0x4f, 0x64, 0x4a, 0x12, 0x70, 0x2b, 0x5e, 0x67, 0x99, 0xd4, 0x32, 0x7d, 0xb1, 0xac, 0xd6,
+    0x38, 0x13, 0xb1, 0xf1, 0xdf, 0xb7, 0xa1, 0x51, 0x78, 0x4f, 0x01, 0xa2, 0xad, 0xe0, 0xc7, 0xc5,
+    0xcf, 0x3f, 0x85, 0xc6, 0x6a, 0xa0, 0x54, 0xd9, 0x6d, 0x50, 0x03, 0x1e, 0x20, 0xb6, 0xfb, 0x29,
+    0x45, 0x81, 0xe9, 0x24, 0x4e, 0x27, 0x9d, 0x0c, 0x32, 0x92, 0x42, 0x24, 0x37, 0x30, 0x81, 0x7c,
+    0xe1, 0xfe, 0x08, 0x29, 0x78, 0xf8, 0x7d, 0x2d, 0x33, 0xb1, 0x2e, 0xfc, 0x0d, 0x69, 0x93, 0x3c,
+    0x40, 0x41, 0xe3, 0xc2, 0x6f, 0x40, 0xce, 0x87, 0xb0, 0x03, 0xfc, 0x91, 0x57, 0x28, 0x25, 0xfe,
+    0xe1, 0xe7, 0xc5, 0x05, 0x56, 0xe2, 0x2a, 0xbd, 0x3d, 0x75, 0xf9, 0xf8, 0xa6, 0xd2, 0xcb, 0xd7,
+    0xc2, 0x0a, 0x2f, 0x38, 0xb4, 0x42, 0x5f, 0x4b, 0xc8, 0xbf, 0x1f, 0xf4, 0x42, 0xd4, 0x46, 0x19,
+    0x68, 0x36, 0x8f, 0x20, 0x00, 0x4e, 0xd2, 0x61, 0x75, 0x33, 0x60, 0x60, 0x13, 0x8d, 0xdc, 0x3d,
+    0x3f, 0x7b, 0x0d, 0x67, 0x5a, 0x0b, 0xe8, 0xc6, 0x55, 0x4b, 0xfa, 0x08, 0x99, 0xca, 0x24, 0x62,
+    0xd2, 0x1c, 0x39, 0xd3, 0xba, 0xd2, 0x6e, 0xf5, 0x1e, 0xb0, 0xbc, 0x4f, 0x9a, 0xa8, 0xdd, 0x53,
+    0x55, 0x36, 0xf5, 0xc5, 0x64, 0xaa, 0x2c, 0xa5, 0x59, 0x55, 0x22, 0x2e, 0x42, 0xa7, 0xae, 0x96,
+    0x91, 0x5c, 0xae, 0x88, 0x87, 0x70, 0x67, 0xbc, 0x56, 0x85, 0x45, 0x4d, 0x57, 0x4b, 0xf6, 0x3b,
+    0x25, 0xdd, 0xef, 0x3b, 0xbf, 0x68, 0xf8, 0x4f, 0xea, 0x77, 0x58, 0x74, 0x19, 0x42, 0x95, 0x9a,
+    0xc3, 0x99, 0x9c, 0x4f, 0x7b, 0x74, 0x32, 0xcc, 0x2a, 0x7d, 0x26, 0xe0, 0x90, 0xb6, 0x3a, 0x6e,
+    0xc0, 0x8d, 0x74, 0x32, 0x67, 0x4f, 0xe6, 0xac, 0x3f, 0x4b, 0xd5, 0x06, 0xf4, 0x20, 0x8c, 0x99,
+    0x73, 0x52, 0xcd, 0xa3, 0x59, 0x21, 0x62, 0x59, 0x44, 0x54, 0x3d, 0xb3, 0x91, 0xff, 0x7b, 0xa6,
+    0xca, 0x15, 0xe8, 0xc6, 0xde, 0xae, 0xc0, 0xbf, 0x16, 0x1b, 0x9c, 0x6d, 0x44, 0xb1, 0xc6, 0x47,
+    0x1f, 0xd5, 0x7a, 0x13, 0x52, 0xcd, 0xf6, 0x39, 0xe5, 0x95, 0x23, 0x91, 0x39, 0x77, 0x85, 0x41,
+    0x7b, 0x8a, 0x76, 0xae, 0x70, 0x00, 0xe9, 0x93, 0x2b, 0x13, 0xba, 0x6b, 0x3c, 0xea, 0x4f, 0x1b,
+    0xf5, 0x5e, 0xc1, 0x2b, 0x2a, 0xb3, 0x07, 0xb5, 0xb9, 0x02, 0x3c, 0x50, 0x97, 0x34, 0xea, 0xdc,
+    0xc1, 0xcf, 0xb5, 0x25, 0x7b, 0xda, 0xa6, 0xdd, 0x02, 0x6f, 0x4f, 0x0d, 0x3e, 0x07, 0xf1, 0xb2,
+    0xad, 0xec, 0x16, 0x49, 0xc7, 0x39, 0xa6, 0x50, 0xf0, 0xf3, 0x11, 0xf5, 0x1c, 0xa1, 0x4a, 0xa9,
+    0xf9, 0x3e, 0x4e, 0x4d, 0x86, 0x73, 0xb6, 0x54, 0xe5, 0x9c, 0x8f, 0xf1, 0x2b, 0x3e, 0xcd, 0xf9,
+    0xf1, 0xd3, 0xa7, 0x07, 0xc8, 0xe3, 0x6f, 0x20, 0x8f, 0x81, 0xfc, 0xc9, 0x37, 0xa1, 0x4f, 0xbd,
+    0x75, 0xa5, 0xfc, 0x64, 0x17, 0x2a, 0x46, 0x57, 0xbb, 0x0e, 0x15, 0x0a, 0x46, 0x5f, 0x60, 0x01,
+    0x02, 0xde, 0x0b, 0x9b, 0x87, 0x1a, 0x55, 0x9c, 0x06, 0x3b, 0x51, 0xec, 0x9f, 0x44, 0x7e, 0x6c,
+    0xc4, 0x00, 0x6a, 0x00, 0x29, 0xbf, 0xf6, 0xbf, 0xfb, 0xb5, 0x0f, 0x1b, 0xcc, 0x4a, 0x94, 0x07,
+    0x26, 0x36, 0x31, 0xc2, 0xa9, 0x8e, 0x28, 0x02, 0x7f, 0x20, 0xa3, 0xff, 0xdd, 0x6c, 0x44, 0xf7,
+    0xa3, 0xd9, 0x08, 0x8e, 0xfa, 0xcc, 0x9f, 0x6f, 0x44, 0x2a, 0xd9, 0xdb, 0x92, 0x81, 0x1c, 0xe0,
+    0xb5, 0xd4, 0x0c, 0x1e, 0x0c, 0x70, 0xb9, 0x5e, 0xc6, 0xf0, 0xe6, 0xbe, 0xe7, 0x4e, 0xfe, 0x35,
+    0x1e, 0x1f, 0xb8, 0x2e, 0xfb, 0x56, 0x8e, 0x65, 0xfb, 0xbe, 0x73, 0xf1, 0x55, 0x19, 0x0b, 0x5c,
+    0x15, 0x14, 0xb2, 0xbc, 0xb6, 0x39, 0x58, 0x0d, 0x74, 0x58, 0x83, 0x8c, 0xd7, 0xd6, 0xa2, 0x7e,
+    0x3c, 0x0a, 0xff, 0xc1, 0x1b, 0x4f, 0xc4, 0xb6, 0x3c, 0x4a, 0x49, 0x8d, 0x76, 0x1a, 0x0b, 0x95,
+    0xdc, 0x78, 0x85, 0xa1, 0x59, 0xe1, 0x43, 0xee, 0x82, 0x81, 0x9e, 0xe2, 0x08, 0x6f, 0x57, 0x84,
+    0x3c, 0xfa, 0x28, 0x97, 0x68, 0xfa, 0xb3, 0x91, 0x17, 0xda, 0xfa, 0x85, 0x7b, 0x37, 0xa1, 0x30,
+    0x89, 0x0f, 0xd2, 0x2a, 0x59, 0x2f, 0x89, 0x71, 0x40, 0x37, 0x67, 0x85, 0xa4, 0x3f, 0x5f, 0xde,
+    0xbe, 0x4d, 0x03, 0xa7, 0x86, 0x0f, 0x7c, 0x44, 0xff, 0x7d, 0xf1, 0xfe, 0x1c, 0x66, 0xe5, 0x5f,
+    0x39, 0x2e, 0xd2, 0x14, 0x7a, 0x71, 0xc1, 0x0f, 0x30, 0xa9, 0x02, 0x42, 0x71, 0x8b, 0x4b, 0x5d,
+    0xbb, 0x67, 0xbb, 0x19, 0xe5, 0x39, 0xe3, 0x31, 0x4d, 0x03, 0x9c, 0x81, 0x0d, 0x4b, 0x30, 0x0e,
+    0xdf, 0x6b, 0x86, 0x5e, 0x5c, 0x4b, 0x25, 0x6e, 0x34, 0xf0, 0xb2, 0x2e, 0xbb, 0x02, 0x8f, 0xd8,
+    0xe4, 0xaa, 0x26, 0x98, 0xd5, 0xda, 0xe4, 0xc1, 0x1d, 0xb3, 0x10, 0x37, 0x39, 0x3e, 0x45, 0xdc,
+    0x86, 0x2c, 0x39, 0xf5, 0x17, 0x9f, 0xbb, 0x1f, 0xd4, 0x23, 0xf6, 0xfe, 0x91, 0xb9, 0x7f, 0xc4,
+    0xbd, 0xfb, 0xbb, 0x31, 0x76, 0x27, 0xc7, 0x3f, 0x0c, 0x59, 0xb6, 0xbf, 0x9e, 0x61, 0x1d, 0x83,
+    0x8a, 0xe7, 0xce, 0x9d, 0x7b, 0xf7, 0xd0, 0x12, 0xc7, 0x37, 0x2c, 0xda, 0x62, 0x4e, 0xc1, 0xe6,
+    0xf5, 0xb0, 0xf1, 0x9f, 0x8f, 0xe7, 0x0b, 0x29, 0x74, 0x92, 0x7f, 0x10, 0xa0, 0x52, 0x77, 0x9b,
+    0x76, 0x43, 0xb1, 0xa2, 0xb6, 0x13, 0xf0, 0x12, 0x70, 0x3a, 0x66, 0x0d, 0xbe, 0xc5, 0x99, 0x7b,
+    0x97, 0x2d, 0x8d, 0x2e, 0x6a, 0x48, 0xfc, 0x87, 0x14, 0xd8, 0xdb, 0x4a, 0xda, 0xad, 0xe4, 0x50,
+    0x65, 0xdc, 0x6e, 0xc5, 0x87, 0xb7, 0xb2, 0x76, 0x2b, 0x1b, 0xf8, 0x24, 0x69, 0x7a, 0x99, 0x58,
+    0xa9, 0x11, 0x5a, 0xd9, 0xa8, 0x69, 0xc7, 0x5f, 0xe9, 0x69, 0xce, 0xfa, 0xfd, 0xee, 0xa5, 0x43,
+    0x0b, 0x66, 0x08, 0x06, 0x7e, 0xc9, 0xba, 0x86, 0xd6, 0xab, 0x1b, 0x1a, 0x7b, 0xfc, 0xf8, 0x60,
+    0x66, 0x98, 0xbb, 0x99, 0xe1, 0xee, 0x60, 0xd6, 0x9b, 0xb2, 0xa6, 0x95, 0xf3, 0xbb, 0x3e, 0xf5,
+    0x5c, 0x6d, 0xfb, 0xa7, 0x34, 0x11, 0xdc, 0xbb, 0x06, 0xd7, 0xf3, 0x3d, 0xcf, 0x49, 0x44, 0x86,
+    0xb5, 0x9d, 0xad, 0xee, 0x8c, 0x94, 0x00, 0xae, 0x1d, 0xe2, 0x17, 0x36, 0x5a, 0x67, 0x9e, 0x0b,
+    0xe5, 0x07, 0xf4, 0x34, 0x65, 0x64, 0x28, 0x8a, 0x22, 0xb8, 0xec, 0x9a, 0x0b, 0xca, 0xc8, 0xd4,
+    0x35, 0x1f, 0xec, 0xd9, 0xf1, 0x87, 0xa1, 0xf1, 0x6e, 0x30, 0xfc, 0xb2, 0x63, 0x1e, 0x3c, 0x7f,
+    0x55, 0xaf, 0xb6, 0xf1, 0x4c, 0x9b, 0x5c, 0xa1, 0x56, 0x91, 0x5e, 0x8e, 0xaf, 0x90, 0xb3, 0x6e,
+    0xec, 0xc1, 0xd7, 0x97, 0x0a, 0x0d, 0x6a, 0x5e, 0xd1, 0x19, 0x1a, 0x48, 0x3b, 0x13, 0x7f, 0x12,
+    0x16, 0x6a, 0xa9, 0xac, 0x09, 0x9b, 0x7e, 0x6d, 0xa6, 0x3d, 0x27, 0x2b, 0x04, 0x93, 0x75, 0xf7,
+    0x9b, 0xfb, 0xcd, 0xb6, 0xa7, 0x65, 0x7f, 0x00, 0x7d, 0x87, 0x58, 0x7c, 0x77, 0xe4, 0x6b, 0x28,
+    0xde, 0x8b, 0x4f, 0x0d, 0x3f, 0xd4, 0x8c, 0xff, 0x80, 0x8e, 0xfa, 0x89, 0x92, 0x5e, 0x4e, 0xae,
+    0x08, 0x99, 0xd9, 0xe7, 0x28, 0x9f, 0x5d, 0x60, 0x6f, 0xff, 0xa8, 0x99, 0x8d, 0xfc, 0x2b, 0x8b,
+    0x32, 0x08, 0x4f, 0x9d, 0x7c, 0x12, 0xd1, 0x78, 0x73, 0x5e, 0xc3, 0xc2, 0xee, 0x84, 0x56, 0x4f,
+    0xa2, 0x26, 0xac, 0x58, 0x39, 0xc1, 0x4a, 0xa7, 0x3b, 0xaa, 0x32, 0xab, 0x78, 0xf4, 0x86, 0x06,
+    0x14, 0x89, 0xca, 0x61, 0x34, 0x24, 0xf8, 0xb7, 0x05, 0x09, 0x31, 0x18, 0x7b, 0xd0, 0x0b, 0x6c,
+    0x85, 0xc7, 0x87, 0xa9, 0xdf, 0x3d, 0xa2, 0x4c, 0x3b, 0xb3, 0xf4, 0xd0, 0x7d, 0xe7, 0x55, 0x91,
+    0x32, 0xc0, 0x57, 0x45, 0xfd, 0xe6, 0xf9, 0x44, 0xc3, 0xaa, 0x0c, 0x3d, 0x71, 0x7a, 0x85, 0x2a,
+    0xf5, 0x4c, 0xcc, 0xa3, 0x66, 0xf5, 0x41, 0x22, 0xa7, 0x63, 0x35, 0x35, 0xee, 0x18, 0xbc, 0x21,
+    0x37, 0x1e, 0xbd, 0x48, 0x53, 0xf6, 0xae, 0x0e, 0x58, 0x4b, 0xd4, 0x5f, 0x10, 0xd5, 0x5e, 0xdf,
+    0x67, 0x1b, 0x1e, 0xed, 0x3d, 0x92, 0x3a, 0x52, 0xc8, 0x53, 0x18, 0x75, 0x57, 0xb5, 0x9b, 0xc0,
+    0x26, 0x4b, 0x08, 0x31, 0xeb, 0x18, 0x31, 0xc2, 0xa4, 0xe0, 0x07, 0xc1, 0xfd, 0x79, 0xd6, 0x3d,
+    0x4f, 0x5d, 0x73, 0xfc, 0xc9, 0xf5, 0x43, 0x56, 0x65, 0x0c, 0x31, 0x30, 0x2c, 0x98, 0x1c, 0xf9,
+    0x1e, 0x4d, 0x06, 0xd5, 0xc1, 0x8f, 0xea, 0xb6, 0x3b, 0x38, 0xfd, 0x6a, 0x47, 0xf5, 0xcf, 0xe5,
+    0x36, 0x6d, 0x1b, 0x09, 0xf5, 0x97, 0xeb, 0xb7, 0xee, 0x59, 0xdc, 0xbd, 0xeb, 0x41, 0xb6, 0xad,
+    0xd7, 0x59, 0xd8, 0x1d, 0x75, 0xe9, 0xfc, 0x88, 0x0c, 0xc2, 0xaf, 0x68, 0x9e, 0xce, 0x3c, 0x7a,
+    0x5c, 0x08, 0xad, 0xa7, 0xec, 0xa5, 0xc0, 0x2b, 0x13, 0x51, 0x7e, 0x2d, 0x4c, 0x1e, 0x57, 0x98,
+    0x26, 0x67, 0x23, 0x01, 0xb0, 0x2e, 0xad, 0xe0, 0x0c, 0x7a, 0xcf, 0xf7, 0xfe, 0x02, 0x57, 0x20,
+    0xb5, 0xb1, 0xd7, 0x0f, 0x00, 0x00,
+};
+
+// system.html: 1561 bytes gzipped
+static const uint8_t WEB_SYSTEM_HTML[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x57, 0xdb, 0x72, 0xdb, 0x36,
+    0x10, 0x7d, 0xd7, 0x57, 0x20, 0xe9, 0xb4, 0xa0, 0x1a, 0x9b, 0x94, 0x7c, 0x69, 0x1b, 0x4b, 0x62,
+    0x26, 0x71, 0xe2, 0x49, 0x3b, 0x76, 0x92, 0x89, 0x9c, 0x49, 0x67, 0xda, 0x3e, 0x40, 0x04, 0x28,
+    0x21, 0x26, 0x09, 0x16, 0x00, 0x25, 0x2b, 0x19, 0xff, 0x7b, 0xcf, 0x82, 0xb4, 0x2d, 0xc7, 0x51,
+    0xdc, 0xf1, 0x83, 0xa5, 0x05, 0x76, 0xf7, 0xec, 0xe5, 0x2c, 0x56, 0xe3, 0x85, 0x2f, 0x8b, 0x74,
+    0xbc, 0x50, 0x42, 0xa6, 0xe3, 0x52, 0x79, 0xc1, 0x2a, 0x51, 0xaa, 0x09, 0x5f, 0x6a, 0xb5, 0xaa,
+    0x8d, 0xf5, 0x9c, 0x65, 0xa6, 0xf2, 0xaa, 0xf2, 0x13, 0xbe, 0xd2, 0xd2, 0x2f, 0x26, 0x52, 0x2d,
+    0x75, 0xa6, 0x76, 0xc3, 0x97, 0x1d, 0xa6, 0x2b, 0xed, 0xb5, 0x28, 0x76, 0x5d, 0x26, 0x0a, 0x35,
+    0x19, 0xf2, 0xb4, 0x37, 0x2e, 0x74, 0x75, 0xc1, 0xac, 0x2a, 0x26, 0xdc, 0xf9, 0x75, 0xa1, 0xdc,
+    0x42, 0x29, 0x58, 0x59, 0x58, 0x95, 0x4f, 0x78, 0x12, 0x44, 0x71, 0xe6, 0xdc, 0xb3, 0xe5, 0x64,
+    0x5f, 0x3d, 0xcd, 0x0e, 0xd4, 0xc1, 0x60, 0xef, 0xa9, 0xda, 0x1b, 0xfc, 0x36, 0x7c, 0x4a, 0xca,
+    0x2e, 0xb3, 0xba, 0xf6, 0x69, 0x2f, 0x6f, 0xaa, 0xcc, 0x6b, 0x53, 0xb1, 0xa6, 0x2e, 0x8c, 0x90,
+    0x27, 0xab, 0xa8, 0xcf, 0xbe, 0xf4, 0x96, 0xc2, 0xb2, 0x5c, 0x17, 0x8a, 0x4d, 0x98, 0x34, 0x59,
+    0x53, 0x02, 0x56, 0x3c, 0x57, 0xfe, 0x55, 0xa1, 0xe8, 0xe3, 0x8b, 0xf5, 0xef, 0x32, 0xe2, 0xf9,
+    0xea, 0x04, 0x37, 0x78, 0x3f, 0xa6, 0x8b, 0xee, 0xaf, 0xc1, 0x3f, 0xa3, 0x9e, 0xce, 0xa3, 0x47,
+    0xf4, 0x0d, 0x26, 0x18, 0x60, 0x5a, 0x1f, 0xf1, 0xa9, 0x2a, 0x54, 0xe6, 0x99, 0x08, 0xe6, 0x1e,
+    0xf1, 0xfe, 0x08, 0x88, 0x7d, 0x63, 0xab, 0x11, 0xbb, 0x6a, 0xbd, 0x48, 0xf8, 0xa8, 0xd4, 0x8a,
+    0x9d, 0x18, 0x5b, 0xbe, 0x14, 0x5e, 0x44, 0xb8, 0x92, 0xcb, 0x58, 0xd4, 0xb5, 0xaa, 0xe0, 0xa5,
+    0xa9, 0xa5, 0xf0, 0x8a, 0xef, 0x04, 0xfd, 0xfe, 0x28, 0xe8, 0x5c, 0x2e, 0x6c, 0xa7, 0xf4, 0xe7,
+    0xd9, 0xe9, 0x6b, 0xef, 0xeb, 0xf7, 0xea, 0xdf, 0x46, 0x39, 0x0f, 0xd5, 0x1e, 0xce, 0xe2, 0x36,
+    0x94, 0x58, 0x48, 0xf9, 0x6a, 0x09, 0xb8, 0xa7, 0xda, 0x21, 0xaf, 0xca, 0x46, 0xbc, 0xb6, 0x66,
+    0x6e, 0x95, 0x73, 0x64, 0xae, 0x8b, 0x3b, 0x22, 0xb0, 0x04, 0x5c, 0xc5, 0x85, 0xaa, 0xe6, 0x7e,
+    0x71, 0x6c, 0xca, 0xba, 0xf1, 0x62, 0x16, 0xa2, 0x08, 0xee, 0x6a, 0x38, 0x3b, 0x13, 0x7e, 0x11,
+    0x5b, 0xd3, 0x00, 0x12, 0xdd, 0x84, 0x79, 0x25, 0x13, 0x15, 0x7b, 0xe3, 0x45, 0xd1, 0xff, 0x79,
+    0x38, 0x18, 0xc0, 0xf5, 0xd6, 0x4c, 0xdd, 0xb8, 0xed, 0xc7, 0x6d, 0x59, 0xa4, 0x76, 0x75, 0x21,
+    0xd6, 0x13, 0x3e, 0x2b, 0x4c, 0x76, 0xc1, 0xbf, 0xa7, 0x9a, 0x79, 0x68, 0xe9, 0x0a, 0xf0, 0xcf,
+    0xd5, 0xa5, 0x07, 0x92, 0x3a, 0xa4, 0xb9, 0x66, 0xe9, 0x84, 0x91, 0x5b, 0x60, 0xfc, 0x3f, 0x7e,
+    0x83, 0x85, 0xd7, 0xe7, 0x67, 0xa7, 0xb0, 0xc0, 0xc7, 0xae, 0x16, 0x15, 0x0b, 0x50, 0x26, 0x8f,
+    0x33, 0x53, 0x18, 0x7b, 0x84, 0x7b, 0xaa, 0x7a, 0x9c, 0x4e, 0x9b, 0x2c, 0x83, 0xc2, 0x23, 0xf6,
+    0x5e, 0xcd, 0x8c, 0xf1, 0xba, 0x9a, 0xc7, 0x71, 0x3c, 0x4e, 0xe8, 0x7e, 0x0a, 0x98, 0x4e, 0xf9,
+    0x73, 0x5d, 0x2a, 0xd3, 0xf8, 0xe8, 0x26, 0x7f, 0xfd, 0x2f, 0x6c, 0xa5, 0x2b, 0x69, 0x56, 0xc8,
+    0x4a, 0x26, 0x48, 0x14, 0x77, 0x2d, 0xc8, 0x51, 0xe3, 0x1d, 0x76, 0x38, 0x08, 0xc9, 0xb9, 0xa2,
+    0x3f, 0xa4, 0x5d, 0x14, 0x4e, 0x75, 0x65, 0x32, 0xa8, 0x70, 0xc4, 0xdf, 0xbd, 0x9d, 0x9e, 0xa3,
+    0x1e, 0x3c, 0xe9, 0x2a, 0x8d, 0xf2, 0xd3, 0xa1, 0xa3, 0xea, 0xe7, 0x32, 0x68, 0xe6, 0xca, 0x67,
+    0x8b, 0x88, 0x27, 0xa2, 0xd6, 0x89, 0x5b, 0xa3, 0x98, 0x25, 0x22, 0xf2, 0x0b, 0x68, 0xa3, 0x0f,
+    0x52, 0x66, 0xe3, 0x4f, 0x8e, 0x80, 0x74, 0x32, 0x49, 0xb2, 0xef, 0x64, 0x65, 0xd6, 0xe8, 0x42,
+    0xbe, 0x0c, 0xae, 0xee, 0x24, 0x56, 0xc6, 0x37, 0x27, 0xa3, 0x07, 0xb4, 0x29, 0x09, 0xdf, 0xd6,
+    0xa6, 0x13, 0x40, 0x06, 0xec, 0x24, 0x61, 0xa7, 0x7a, 0xa9, 0x90, 0x66, 0xe1, 0x1b, 0xc7, 0x72,
+    0x6b, 0x4a, 0x96, 0xac, 0x5c, 0xe2, 0x15, 0x99, 0xf3, 0x76, 0x4d, 0x4c, 0x00, 0xe5, 0x2b, 0xd0,
+    0xc3, 0x31, 0x9d, 0x33, 0x80, 0x67, 0x19, 0xf5, 0x03, 0x93, 0xd6, 0xd4, 0x10, 0xf9, 0xd0, 0x7d,
+    0x2b, 0x37, 0xba, 0x25, 0x69, 0x01, 0x8b, 0xc7, 0xad, 0x4e, 0xe0, 0xe9, 0xca, 0x75, 0x44, 0xf8,
+    0xa8, 0x66, 0x53, 0xa8, 0x2a, 0x30, 0x6e, 0xe5, 0x8e, 0x92, 0x84, 0xb3, 0x27, 0xec, 0xb6, 0x1e,
+    0xc6, 0x79, 0x7c, 0xe7, 0x77, 0xdc, 0x23, 0xd1, 0x50, 0x8f, 0x4d, 0x45, 0x65, 0x80, 0x15, 0x32,
+    0xfd, 0x3e, 0xc4, 0x1e, 0xa4, 0x40, 0xe2, 0x88, 0xfe, 0xb7, 0x75, 0x06, 0xa7, 0x37, 0xea, 0xbf,
+    0x81, 0x64, 0x87, 0xed, 0x85, 0x1a, 0xb3, 0xab, 0x4e, 0xb7, 0x44, 0x0b, 0x89, 0xf9, 0x1d, 0xed,
+    0x1b, 0x32, 0x11, 0xdd, 0xff, 0x98, 0xbe, 0x7d, 0x13, 0xd7, 0xc2, 0x3a, 0x05, 0x2e, 0xa1, 0xe8,
+    0xa2, 0xbf, 0xc3, 0xda, 0x1c, 0x7a, 0x58, 0xdf, 0x61, 0x45, 0xf8, 0x5c, 0x18, 0x53, 0xb7, 0x7c,
+    0x2f, 0x29, 0xca, 0x88, 0x0f, 0x06, 0x14, 0x55, 0x60, 0x62, 0x8e, 0x43, 0x1b, 0xf9, 0x18, 0x89,
+    0x4d, 0x88, 0x06, 0x03, 0x14, 0xdf, 0x15, 0x18, 0x97, 0xd1, 0xee, 0xfe, 0xf7, 0x98, 0x48, 0xa8,
+    0xbf, 0x51, 0x3c, 0x1f, 0x2f, 0x45, 0xa1, 0x25, 0x7b, 0x86, 0x4f, 0x94, 0xb5, 0x82, 0xb2, 0x15,
+    0x93, 0x37, 0xb8, 0x3e, 0x62, 0xbc, 0x32, 0x9e, 0x62, 0xe7, 0x0f, 0x58, 0x9e, 0xae, 0xab, 0xec,
+    0x9e, 0x65, 0x67, 0x1a, 0x9b, 0xd1, 0xa4, 0xf8, 0x80, 0x89, 0x66, 0x8f, 0x05, 0x82, 0xee, 0xb3,
+    0x27, 0xbd, 0x48, 0xc6, 0x0e, 0xd7, 0xe3, 0xca, 0xd7, 0x70, 0x0b, 0x02, 0xbc, 0x39, 0x7f, 0xc7,
+    0xc8, 0xe3, 0xc6, 0xc1, 0xf3, 0xb9, 0x9a, 0xb2, 0x31, 0x1b, 0xd0, 0x85, 0x95, 0xd0, 0x44, 0x47,
+    0x0e, 0x38, 0x5f, 0x5d, 0x00, 0x54, 0xe6, 0x98, 0x98, 0x1b, 0xde, 0x27, 0xac, 0xad, 0x25, 0x93,
+    0xe7, 0x7c, 0xd3, 0x8d, 0xf5, 0x59, 0xeb, 0xe6, 0xfd, 0xf9, 0x31, 0xcb, 0x69, 0x8e, 0xf1, 0xf6,
+    0x72, 0x65, 0x48, 0xc4, 0x1f, 0x4a, 0xda, 0x99, 0xf2, 0xca, 0xba, 0x7b, 0x3d, 0x5f, 0x06, 0x71,
+    0x5c, 0x8a, 0xfa, 0x76, 0x20, 0x94, 0x54, 0xea, 0x76, 0xc8, 0xb3, 0x32, 0x96, 0x8d, 0x5f, 0x07,
+    0x88, 0x49, 0x88, 0xae, 0x8c, 0xbd, 0xb0, 0x70, 0x80, 0x7c, 0x9c, 0xe8, 0x4b, 0x25, 0xa3, 0x21,
+    0x31, 0xbc, 0x1f, 0x7f, 0x32, 0x1a, 0xb3, 0x80, 0xfd, 0xdd, 0x0c, 0x06, 0xb3, 0x5f, 0xd9, 0x83,
+    0x70, 0x4e, 0x95, 0xbc, 0x87, 0xa5, 0x50, 0x32, 0x56, 0xd6, 0x1a, 0x4b, 0x81, 0x76, 0xad, 0x49,
+    0x9c, 0x09, 0x32, 0x44, 0xdb, 0x6b, 0xaf, 0x84, 0x79, 0x17, 0x10, 0x09, 0x1f, 0x20, 0xb5, 0xe2,
+    0x99, 0xd5, 0xf3, 0x85, 0xaf, 0xd0, 0xb9, 0xe1, 0x2c, 0xba, 0x3d, 0xc9, 0x90, 0xad, 0x40, 0x1f,
+    0x76, 0xfa, 0xea, 0xa5, 0xeb, 0x3f, 0xd4, 0x04, 0xa7, 0x68, 0xdb, 0xaf, 0xb0, 0x15, 0x71, 0x5e,
+    0xb7, 0x66, 0xf1, 0x1f, 0x33, 0xd0, 0xe2, 0xe1, 0x0f, 0xae, 0x71, 0x40, 0x9f, 0x9f, 0x2f, 0xe7,
+    0x1f, 0x70, 0xde, 0xe3, 0x0c, 0xfd, 0x2c, 0x96, 0xf3, 0x2e, 0x57, 0xdd, 0xe9, 0x99, 0xb8, 0xfc,
+    0xd0, 0x6a, 0x97, 0xe2, 0x12, 0xe4, 0xc0, 0x02, 0xd1, 0x1d, 0xd3, 0xc7, 0xee, 0xa8, 0x81, 0xdd,
+    0x56, 0x68, 0x96, 0x08, 0xb8, 0xa9, 0x5a, 0xf1, 0xf5, 0x17, 0x80, 0xbe, 0x0a, 0x93, 0x74, 0x73,
+    0x90, 0x10, 0xdb, 0xa3, 0xf6, 0xf5, 0x63, 0x11, 0x88, 0x6b, 0x61, 0x6e, 0x3d, 0xc5, 0xb8, 0x02,
+    0x73, 0xf1, 0xb8, 0xf4, 0x89, 0xcc, 0x61, 0x0c, 0x07, 0xbe, 0x3a, 0x6f, 0xd1, 0x7f, 0x3a, 0x5f,
+    0x47, 0x5f, 0x16, 0x9f, 0x8f, 0xd8, 0x93, 0xef, 0x26, 0xe1, 0xf5, 0x67, 0xa4, 0x00, 0x9c, 0x6a,
+    0xd4, 0x55, 0x3f, 0x8c, 0xf0, 0x3b, 0x83, 0x6b, 0xd4, 0xc3, 0x93, 0xd2, 0xee, 0x1f, 0xe3, 0xa4,
+    0x5d, 0x88, 0x66, 0x46, 0xae, 0xb1, 0x95, 0x2c, 0x86, 0xe9, 0x89, 0xb6, 0xe5, 0x4a, 0x58, 0x85,
+    0x93, 0x21, 0x24, 0x52, 0x2f, 0x31, 0x15, 0x85, 0x73, 0x13, 0x9e, 0x09, 0x2b, 0x39, 0x36, 0xa8,
+    0xfd, 0xf4, 0xb8, 0xb1, 0x16, 0xfe, 0xd8, 0xc6, 0xdd, 0x7d, 0xdc, 0xad, 0xd3, 0x31, 0x50, 0x9a,
+    0x6a, 0x9e, 0xbe, 0xa0, 0x59, 0xcc, 0x68, 0x94, 0x1f, 0xc1, 0x55, 0x2b, 0x63, 0xed, 0xb3, 0xa7,
+    0xe5, 0x64, 0xe3, 0x09, 0x48, 0xbb, 0xc7, 0x6d, 0x9c, 0xd4, 0xdf, 0x30, 0x40, 0xa3, 0x62, 0xbb,
+    0x81, 0x30, 0x48, 0xee, 0x1a, 0x48, 0x00, 0x77, 0x1b, 0xe8, 0xf0, 0x1a, 0x4c, 0xc3, 0x6b, 0x70,
+    0x0f, 0xef, 0x56, 0x47, 0x37, 0x03, 0x6b, 0x1b, 0x50, 0x9a, 0x39, 0x5b, 0x35, 0xc3, 0x40, 0xda,
+    0xa6, 0xf9, 0x46, 0x29, 0x89, 0xc5, 0x8d, 0x45, 0xef, 0x3e, 0x9e, 0xa1, 0xe3, 0x5a, 0x5e, 0xf6,
+    0xb7, 0xda, 0xea, 0x26, 0xc0, 0x36, 0x6b, 0xc4, 0x8d, 0xad, 0xba, 0x44, 0xd7, 0xad, 0x8a, 0xe0,
+    0xcb, 0x76, 0x45, 0x22, 0xd3, 0x5d, 0xcd, 0x42, 0xcc, 0x54, 0x91, 0x7e, 0x08, 0xcb, 0x82, 0x63,
+    0x18, 0xa9, 0x98, 0xcc, 0x78, 0x46, 0xe5, 0x38, 0x69, 0x4f, 0xb0, 0xda, 0xb6, 0x2b, 0xe7, 0xb5,
+    0x0d, 0xf4, 0x22, 0xc3, 0x7b, 0xb6, 0x10, 0xd5, 0x5c, 0xb5, 0x92, 0xb6, 0xf1, 0x69, 0x0b, 0x36,
+    0x35, 0xb1, 0x21, 0x1d, 0x8e, 0x93, 0xee, 0xd3, 0xb5, 0xe4, 0xf0, 0x6b, 0x09, 0x6b, 0xad, 0x2a,
+    0x99, 0x0e, 0x07, 0xf7, 0x6e, 0xef, 0x1d, 0xde, 0x37, 0x70, 0x7b, 0x8b, 0xba, 0x3d, 0x28, 0x3f,
+    0xd0, 0x20, 0xd7, 0xdd, 0xcc, 0xda, 0xe0, 0xba, 0x26, 0xd1, 0x15, 0xd6, 0x51, 0xe6, 0xd7, 0x35,
+    0xc0, 0xd3, 0x0e, 0xcc, 0x43, 0x60, 0xdd, 0xf2, 0xcd, 0x04, 0xf6, 0xb5, 0x1a, 0x3f, 0x19, 0xe2,
+    0x99, 0xae, 0x28, 0xa0, 0x59, 0xe3, 0x3d, 0xc0, 0xd2, 0xfb, 0xad, 0xb3, 0x8b, 0x09, 0xbf, 0xdd,
+    0xea, 0x79, 0xb7, 0xf0, 0xf1, 0x99, 0xc8, 0x2e, 0xe6, 0x61, 0x95, 0xdd, 0x6d, 0x77, 0xbf, 0x1f,
+    0xf2, 0x83, 0x83, 0xfd, 0xfd, 0x5f, 0x46, 0x98, 0x2f, 0x76, 0xae, 0xab, 0x5d, 0x8f, 0x82, 0x0c,
+    0x07, 0xf5, 0xe5, 0x88, 0x23, 0xcd, 0xa4, 0xbe, 0xc1, 0xb3, 0xd6, 0x7e, 0x17, 0x01, 0x01, 0xb9,
+    0xd9, 0x31, 0xaf, 0xcd, 0x77, 0xbb, 0xed, 0x51, 0x65, 0x2a, 0x75, 0xd7, 0xe4, 0x21, 0x4c, 0xe2,
+    0xed, 0xa9, 0xfc, 0xee, 0x4a, 0xd1, 0xb0, 0x3d, 0x9a, 0x99, 0x42, 0xde, 0x38, 0x69, 0x77, 0xcd,
+    0x8d, 0xfa, 0xd3, 0xea, 0x9b, 0x0e, 0xba, 0xda, 0xff, 0x78, 0x9d, 0xb9, 0xee, 0x9f, 0xb8, 0xfe,
+    0x9d, 0xc3, 0xd3, 0x9f, 0x0a, 0x61, 0xed, 0x88, 0xbd, 0x40, 0x58, 0xcc, 0x1b, 0x90, 0xde, 0x2d,
+    0x66, 0x06, 0x49, 0x1d, 0x27, 0x02, 0x2d, 0x13, 0x06, 0x0b, 0x52, 0x49, 0x3f, 0xbe, 0x7a, 0xff,
+    0x01, 0xe4, 0x50, 0x88, 0xe7, 0x84, 0x0d, 0x00, 0x00,
+};
+
+// time.html: 1841 bytes gzipped
+static const uint8_t WEB_TIME_HTML[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0x6d, 0x6f, 0xdb, 0x38,
+    0x12, 0xfe, 0xee, 0x5f, 0x31, 0x9b, 0x0f, 0x4b, 0xe9, 0x6a, 0xcb, 0x2f, 0xed, 0x2e, 0xb6, 0x89,
+    0xe5, 0xc5, 0xe5, 0x92, 0x5c, 0x0a, 0xd4, 0x4d, 0x50, 0x67, 0xef, 0xc3, 0x19, 0xc6, 0x81, 0x91,
+    0x68, 0x9b, 0x17, 0x4a, 0xd4, 0x91, 0x94, 0x1d, 0x77, 0xd1, 0xff, 0xbe, 0x43, 0x52, 0x92, 0x65,
+    0xc7, 0x7d, 0x39, 0xa0, 0x05, 0x1a, 0x45, 0xd4, 0xcc, 0x33, 0xcf, 0xbc, 0x68, 0x66, 0x94, 0xf1,
+    0xda, 0x64, 0x62, 0x32, 0x5e, 0x33, 0x9a, 0x4e, 0xc6, 0x19, 0x33, 0x14, 0x72, 0x9a, 0xb1, 0x98,
+    0x6c, 0x38, 0xdb, 0x16, 0x52, 0x19, 0x02, 0x89, 0xcc, 0x0d, 0xcb, 0x4d, 0x4c, 0xb6, 0x3c, 0x35,
+    0xeb, 0x38, 0x65, 0x1b, 0x9e, 0xb0, 0x9e, 0xbb, 0xe9, 0x02, 0xcf, 0xb9, 0xe1, 0x54, 0xf4, 0x74,
+    0x42, 0x05, 0x8b, 0x87, 0x64, 0xd2, 0x19, 0x0b, 0x9e, 0x3f, 0x81, 0x62, 0x22, 0x26, 0xda, 0xec,
+    0x04, 0xd3, 0x6b, 0xc6, 0x10, 0x65, 0xad, 0xd8, 0x32, 0x26, 0x7d, 0x77, 0x14, 0x25, 0x5a, 0xff,
+    0xbe, 0x89, 0x5f, 0xb3, 0xb7, 0xc9, 0x1b, 0xf6, 0x66, 0x30, 0x7a, 0xcb, 0x46, 0x83, 0xdf, 0x86,
+    0x6f, 0xad, 0xb2, 0x4e, 0x14, 0x2f, 0xcc, 0xa4, 0xb3, 0x2c, 0xf3, 0xc4, 0x70, 0x99, 0x83, 0x91,
+    0xab, 0x95, 0x60, 0x0f, 0x3c, 0x63, 0x33, 0x59, 0xaa, 0x84, 0x05, 0x21, 0xfc, 0xd9, 0xd9, 0x50,
+    0x05, 0xa5, 0x66, 0x1f, 0x1e, 0xee, 0x21, 0x86, 0x54, 0x26, 0x65, 0x86, 0x04, 0xa3, 0xff, 0x95,
+    0x4c, 0xed, 0x66, 0x4c, 0xb0, 0xc4, 0x48, 0x15, 0x10, 0x9e, 0x17, 0xa5, 0x99, 0x3b, 0x6f, 0xce,
+    0xbc, 0xf0, 0xd9, 0xe2, 0x3c, 0x59, 0xb3, 0xe4, 0x89, 0xa5, 0x24, 0x8c, 0x36, 0x54, 0x94, 0x0c,
+    0xe2, 0x38, 0x06, 0x32, 0x24, 0x17, 0x9d, 0x06, 0x65, 0xc5, 0xcc, 0xb5, 0x60, 0xf6, 0xd7, 0xcb,
+    0xdd, 0xbb, 0x34, 0x20, 0x19, 0xcd, 0x4b, 0x2a, 0x2c, 0x81, 0x2b, 0xbe, 0x41, 0x3d, 0xef, 0x41,
+    0xca, 0x75, 0x21, 0xe8, 0x0e, 0xcd, 0x57, 0x3c, 0x7e, 0x07, 0x92, 0xcb, 0x9c, 0x11, 0x38, 0x07,
+    0xf2, 0x28, 0x64, 0xf2, 0x84, 0x98, 0x9f, 0xf7, 0x6e, 0xe8, 0x5d, 0x9e, 0x5c, 0x2a, 0xb9, 0xd5,
+    0x4c, 0x59, 0xa8, 0xc6, 0x8b, 0x5c, 0x6e, 0x11, 0x23, 0x67, 0x5b, 0xb8, 0xa2, 0x06, 0x8f, 0x2f,
+    0xdc, 0xa9, 0x5c, 0x2e, 0x35, 0x33, 0xf6, 0x81, 0xdc, 0x5a, 0x42, 0x56, 0xe5, 0x13, 0xa2, 0xdf,
+    0xb9, 0x73, 0x54, 0xfe, 0x1b, 0xfc, 0x3a, 0xc0, 0x7f, 0x5e, 0x1a, 0xad, 0x51, 0xf1, 0x4e, 0xcb,
+    0x36, 0x90, 0xc5, 0xed, 0x55, 0x38, 0x61, 0x64, 0xe4, 0xbb, 0xd9, 0xdd, 0xcc, 0x28, 0x9e, 0xaf,
+    0x02, 0xf4, 0x40, 0x60, 0x02, 0x83, 0x41, 0x17, 0x86, 0xbf, 0x86, 0xdf, 0xe5, 0xf8, 0x3e, 0x5a,
+    0x8d, 0xad, 0x43, 0xe7, 0xe8, 0xc6, 0x65, 0x28, 0x60, 0x1b, 0xd4, 0xb6, 0xae, 0xb9, 0x5f, 0xa2,
+    0x42, 0xb9, 0xeb, 0x15, 0x5b, 0xd2, 0x52, 0x18, 0xeb, 0xdc, 0x92, 0x99, 0x64, 0x1d, 0x60, 0x19,
+    0xa0, 0xc6, 0x7f, 0x8c, 0x85, 0xee, 0xc2, 0x9f, 0x80, 0x65, 0xb7, 0x96, 0x29, 0x06, 0xee, 0xfe,
+    0x6e, 0xf6, 0x80, 0x27, 0x8f, 0x32, 0xdd, 0x9d, 0x3b, 0x5f, 0x6e, 0xa4, 0xca, 0xd0, 0x1f, 0xea,
+    0x91, 0x23, 0x43, 0x15, 0xb2, 0x0c, 0xe1, 0x73, 0xd8, 0x89, 0xcc, 0x9a, 0xe5, 0x81, 0x82, 0x78,
+    0x82, 0x00, 0x7c, 0x19, 0xa8, 0x48, 0x3e, 0x85, 0x80, 0x45, 0xa8, 0x4c, 0x40, 0x2c, 0x19, 0x98,
+    0x31, 0x63, 0xd0, 0x61, 0x0d, 0x33, 0x34, 0x96, 0xfe, 0x44, 0xc2, 0x0b, 0x60, 0x42, 0xb3, 0x5a,
+    0xe6, 0x5a, 0x29, 0xa9, 0xdc, 0xe9, 0x67, 0x24, 0xa6, 0x98, 0x29, 0x55, 0x0e, 0x4b, 0x8a, 0x12,
+    0xd6, 0xb7, 0x7e, 0x1f, 0x6e, 0xb8, 0x10, 0x80, 0x56, 0x60, 0x89, 0x24, 0x60, 0xa9, 0x64, 0xe6,
+    0xee, 0x92, 0x52, 0x29, 0xe4, 0x02, 0xba, 0x82, 0xdf, 0x87, 0x61, 0xc9, 0x99, 0x48, 0x03, 0x5b,
+    0x70, 0x18, 0x02, 0xa8, 0x10, 0x4f, 0x84, 0x57, 0x5f, 0xee, 0x3e, 0xa0, 0x90, 0x97, 0x44, 0xf3,
+    0x7b, 0x04, 0x57, 0x9d, 0xee, 0xbc, 0x0b, 0x2e, 0xe2, 0x36, 0x96, 0x2d, 0xd8, 0x08, 0xa9, 0x5c,
+    0x53, 0x8c, 0x60, 0xad, 0x11, 0x28, 0x67, 0x2a, 0xaa, 0xca, 0x1a, 0x13, 0xa4, 0x9a, 0xc2, 0xf6,
+    0x08, 0xde, 0xbd, 0x96, 0x0d, 0x59, 0xd8, 0x8b, 0xae, 0xac, 0x08, 0xae, 0x4d, 0xcb, 0x96, 0x2d,
+    0x27, 0x8d, 0x28, 0x2d, 0x9b, 0xf3, 0xc1, 0xe2, 0xa2, 0x63, 0xc5, 0x5e, 0x1a, 0x97, 0xd6, 0xb8,
+    0x8e, 0x68, 0x8a, 0xa2, 0x98, 0xac, 0xbb, 0xc2, 0x9f, 0xa2, 0x46, 0x17, 0xe4, 0x7c, 0x88, 0x3f,
+    0x5d, 0x3c, 0xfd, 0x4d, 0xc3, 0x28, 0xac, 0x42, 0xae, 0x9b, 0xa2, 0xf2, 0x44, 0x91, 0xa4, 0x35,
+    0x3f, 0xbd, 0x7e, 0xb8, 0xfe, 0x38, 0xc3, 0xd3, 0x39, 0xb9, 0xc5, 0x37, 0x1e, 0xcb, 0x81, 0x4c,
+    0x79, 0x5e, 0x1a, 0x5b, 0x2a, 0x64, 0xc6, 0xb0, 0x1b, 0xa5, 0x04, 0x19, 0xdd, 0x63, 0x3e, 0xb8,
+    0x66, 0x11, 0x15, 0x22, 0x98, 0xd7, 0x65, 0x45, 0x0b, 0xde, 0x47, 0x81, 0x25, 0x5f, 0x61, 0xc9,
+    0xee, 0x0b, 0x44, 0x45, 0xff, 0xd5, 0x48, 0x2c, 0x0c, 0xbb, 0x9d, 0xb6, 0xa4, 0xa9, 0xde, 0x2a,
+    0x7d, 0x5a, 0x78, 0x51, 0x9d, 0x36, 0xee, 0xa6, 0x75, 0x84, 0x12, 0xdb, 0x75, 0x9c, 0x97, 0x4e,
+    0xdd, 0xdd, 0x0d, 0x17, 0x51, 0x46, 0x8b, 0xbd, 0xf0, 0xa7, 0x56, 0x0d, 0xcc, 0x3f, 0x45, 0x3e,
+    0xda, 0x9f, 0xa2, 0x42, 0x6a, 0xfe, 0xbc, 0xf0, 0x01, 0xa8, 0x33, 0x41, 0x6a, 0x22, 0xa4, 0x02,
+    0xec, 0x42, 0x12, 0xd9, 0xb3, 0xa8, 0x7e, 0x70, 0x4a, 0x78, 0xf4, 0x45, 0xe9, 0x91, 0x7d, 0xd1,
+    0x5c, 0x02, 0x49, 0x6e, 0x0a, 0x62, 0x33, 0xd8, 0x84, 0xba, 0x12, 0xc5, 0xf3, 0x8b, 0x8e, 0xaf,
+    0x36, 0xe2, 0x1b, 0x18, 0x69, 0x60, 0x9a, 0x86, 0x36, 0xc4, 0x5e, 0x36, 0x40, 0xac, 0x97, 0x2d,
+    0xb8, 0xd1, 0x5d, 0x0f, 0x47, 0x4e, 0xb1, 0x6a, 0x87, 0x11, 0xde, 0xb7, 0x14, 0x2b, 0x21, 0x9d,
+    0x49, 0x69, 0xd6, 0x98, 0xba, 0x03, 0xd1, 0xe6, 0x14, 0x13, 0xaa, 0x5f, 0x2a, 0x61, 0x4f, 0x60,
+    0xea, 0x4a, 0xf1, 0x0d, 0x73, 0x5a, 0x99, 0xb4, 0xee, 0x47, 0xfb, 0xd3, 0x76, 0x48, 0xfc, 0x43,
+    0xac, 0x88, 0x25, 0x17, 0x56, 0x7c, 0x3e, 0x27, 0xef, 0x79, 0xce, 0xa8, 0x2d, 0x1e, 0x9b, 0xa5,
+    0x39, 0x99, 0xf5, 0xfe, 0x51, 0x2a, 0x07, 0x35, 0x74, 0xf7, 0x57, 0x34, 0x2b, 0x70, 0x0a, 0x74,
+    0x61, 0xb4, 0xe8, 0x76, 0xe6, 0xe4, 0x5f, 0x3c, 0x37, 0x74, 0xc5, 0x20, 0xb8, 0xdb, 0x30, 0xa5,
+    0xd7, 0x48, 0x2c, 0xc4, 0x67, 0xaf, 0x17, 0x8b, 0xb6, 0xe9, 0xb6, 0x91, 0xb6, 0x75, 0x9f, 0xe4,
+    0xa9, 0x4c, 0x2b, 0xd3, 0x1f, 0xb0, 0x5d, 0x50, 0xd1, 0x98, 0xbe, 0xa1, 0xda, 0x78, 0xbb, 0x68,
+    0xe8, 0x5e, 0xb1, 0x1e, 0xcb, 0x50, 0x73, 0x83, 0xc6, 0xfe, 0xcd, 0x94, 0x04, 0x3b, 0xe2, 0xb0,
+    0xab, 0x5c, 0xca, 0x32, 0x4f, 0xa9, 0xda, 0x85, 0x8e, 0x53, 0xdb, 0xee, 0x1e, 0x7e, 0x9f, 0x56,
+    0x7f, 0x36, 0x13, 0x6c, 0x7b, 0x9c, 0xdd, 0x03, 0x25, 0x2b, 0x80, 0xbd, 0xff, 0x86, 0x3f, 0xb3,
+    0x34, 0x18, 0x56, 0xb3, 0x45, 0x50, 0x3b, 0x58, 0x08, 0xda, 0x51, 0xcc, 0xff, 0x76, 0xd1, 0xf1,
+    0xef, 0xdc, 0xcb, 0x17, 0x3c, 0xc3, 0x01, 0x5f, 0x17, 0xfd, 0x13, 0xca, 0x66, 0xbe, 0x19, 0x20,
+    0xc2, 0x2b, 0x54, 0x1c, 0x0b, 0xfa, 0xc8, 0xc4, 0x84, 0xc0, 0x2b, 0xc8, 0xf0, 0x3f, 0x81, 0xb1,
+    0x46, 0xc7, 0xc5, 0x24, 0xc8, 0x18, 0xd5, 0xa5, 0xc2, 0x76, 0x84, 0x8f, 0x3a, 0x41, 0x2b, 0x79,
+    0xfe, 0xf8, 0x3d, 0x0e, 0xa8, 0x3c, 0xd9, 0xfd, 0xa1, 0xe7, 0x7c, 0x01, 0x7d, 0x18, 0xe2, 0x20,
+    0x0b, 0x5b, 0x34, 0x51, 0xe7, 0x2c, 0x1c, 0xf7, 0x3d, 0xd6, 0xd8, 0x4d, 0x71, 0x30, 0xbb, 0x02,
+    0x77, 0x92, 0xbc, 0xcc, 0x1e, 0x99, 0x22, 0x90, 0xf1, 0x3c, 0x26, 0x03, 0xbc, 0xd2, 0xe7, 0x98,
+    0x58, 0x75, 0x02, 0xda, 0xb0, 0x02, 0xcf, 0xa2, 0x21, 0x81, 0x33, 0x0b, 0xe0, 0x97, 0x18, 0x64,
+    0x8a, 0x77, 0x48, 0xfd, 0x15, 0x9c, 0x11, 0xdf, 0x66, 0x62, 0x72, 0x76, 0x40, 0x4a, 0x7c, 0x8b,
+    0x0c, 0x6a, 0x4e, 0xc6, 0x7d, 0xef, 0xea, 0x99, 0x1b, 0x14, 0xa7, 0x9c, 0x3f, 0xfb, 0x36, 0xd1,
+    0x91, 0x23, 0xea, 0x89, 0x21, 0x8a, 0xa5, 0xf1, 0x82, 0xd8, 0x71, 0x06, 0x2f, 0xcb, 0x14, 0xe7,
+    0xc6, 0xd4, 0x91, 0x3b, 0x66, 0xf2, 0xf9, 0x6b, 0xc3, 0xbb, 0x72, 0x0b, 0x3b, 0x1b, 0xcf, 0x73,
+    0xa6, 0x6e, 0x1f, 0xa6, 0xef, 0xed, 0xf4, 0xa6, 0xe6, 0x2b, 0x3a, 0xde, 0xa4, 0x3e, 0xd2, 0xc1,
+    0x53, 0x6f, 0x0b, 0x53, 0xe2, 0x97, 0xb3, 0x71, 0xdf, 0x6f, 0x8b, 0x76, 0x4c, 0xe3, 0xca, 0xb6,
+    0x1e, 0x4e, 0x0e, 0xe6, 0x2d, 0x3e, 0x1e, 0xe2, 0xb1, 0x9b, 0x9a, 0xf8, 0x82, 0x94, 0x8f, 0x19,
+    0x37, 0x71, 0x05, 0x7e, 0xbc, 0x2a, 0xb8, 0x7d, 0xd1, 0x39, 0x74, 0xaf, 0x78, 0x86, 0xf5, 0x0f,
+    0xf5, 0xaa, 0x73, 0x5e, 0x7b, 0x3a, 0xd6, 0x6e, 0xa3, 0xab, 0x02, 0xd7, 0xb4, 0x4a, 0x64, 0xe1,
+    0x1f, 0x34, 0x08, 0xbe, 0x95, 0xb4, 0x31, 0x20, 0xf8, 0xe7, 0xfd, 0xbb, 0x3b, 0x98, 0x6d, 0x39,
+    0x36, 0xfd, 0xf0, 0x1b, 0x88, 0xa3, 0x13, 0x90, 0xb6, 0x0f, 0xce, 0x18, 0x36, 0x0e, 0xb5, 0x57,
+    0x6e, 0xe7, 0xd9, 0xb0, 0x67, 0x53, 0xa7, 0xd4, 0xb6, 0xda, 0x46, 0xd1, 0x07, 0xc4, 0x75, 0xcb,
+    0xbd, 0x66, 0xca, 0x37, 0x90, 0x08, 0xaa, 0x35, 0x46, 0x83, 0xa6, 0x5c, 0xf6, 0x56, 0x4a, 0x96,
+    0x2d, 0xa5, 0x03, 0x68, 0x27, 0x51, 0x63, 0x57, 0x2d, 0xba, 0x2e, 0x14, 0x2c, 0x72, 0x99, 0x27,
+    0x6b, 0x9a, 0xaf, 0x2c, 0x87, 0x17, 0xdd, 0x99, 0x4c, 0xe0, 0xef, 0xa5, 0x91, 0x19, 0x35, 0x3c,
+    0x81, 0x00, 0x15, 0xc3, 0x9a, 0xc2, 0xff, 0x6d, 0x69, 0xf0, 0x4d, 0x4b, 0x53, 0xb7, 0x25, 0xee,
+    0x0d, 0xf4, 0xd1, 0x4b, 0xbc, 0x58, 0x5f, 0x79, 0x1a, 0x1f, 0x6d, 0xcf, 0xe0, 0x96, 0xe7, 0x98,
+    0x54, 0x33, 0xe0, 0xdc, 0x6d, 0xcc, 0xad, 0x04, 0x1a, 0xb7, 0xbc, 0xc2, 0xcf, 0x2e, 0x83, 0xa7,
+    0x43, 0x9e, 0xa2, 0x80, 0x4d, 0x59, 0xcf, 0x6d, 0xa2, 0xe4, 0xc8, 0x48, 0xed, 0x46, 0xeb, 0x04,
+    0xe1, 0x1f, 0x4b, 0x63, 0x6c, 0x9f, 0x75, 0x00, 0xfe, 0xc6, 0xf9, 0x85, 0x7b, 0xf0, 0x13, 0x7e,
+    0xa5, 0x1c, 0xaf, 0xe6, 0x0d, 0x4d, 0x2c, 0xc8, 0x15, 0xcf, 0x7b, 0x46, 0x16, 0xe7, 0xbf, 0x14,
+    0xcf, 0x17, 0x64, 0x32, 0x43, 0x51, 0xa8, 0x64, 0x1d, 0xc7, 0x71, 0xdf, 0xc3, 0x4d, 0x6a, 0xbf,
+    0x3d, 0x63, 0xbb, 0xb8, 0xb8, 0xdd, 0x95, 0x9a, 0x1f, 0x91, 0x7e, 0x3b, 0x65, 0xf7, 0x19, 0x99,
+    0xc0, 0xe8, 0x4d, 0xcf, 0x5a, 0xf8, 0xfe, 0xac, 0xb6, 0x01, 0xf0, 0x1b, 0x0d, 0x86, 0xa3, 0x23,
+    0x80, 0x03, 0xf6, 0xfe, 0x45, 0x82, 0x5b, 0x8a, 0x3f, 0xa6, 0x72, 0xe3, 0x3a, 0xc4, 0x8f, 0x70,
+    0x63, 0xbf, 0x07, 0xb4, 0x9d, 0x79, 0xc0, 0x24, 0x60, 0xdb, 0xf8, 0x7e, 0x67, 0x5e, 0xc2, 0x58,
+    0x97, 0x66, 0x5b, 0xc6, 0x8a, 0x03, 0x9c, 0x03, 0x9f, 0x3e, 0x30, 0x96, 0x0a, 0x06, 0x6e, 0x75,
+    0xf8, 0x11, 0xbe, 0xb4, 0xd6, 0x93, 0x36, 0x8b, 0x5b, 0xaa, 0xd2, 0x2d, 0x55, 0x0c, 0x6e, 0x68,
+    0xca, 0xbe, 0xdf, 0xa5, 0x13, 0x68, 0x36, 0x34, 0x33, 0xb9, 0x34, 0x0e, 0xed, 0x23, 0xae, 0x2b,
+    0x5f, 0x77, 0x6c, 0xea, 0xa6, 0x06, 0x04, 0x18, 0x19, 0x2c, 0x4d, 0x83, 0x6f, 0x2c, 0xf8, 0x15,
+    0xc8, 0x7e, 0x9f, 0x6a, 0xb7, 0x62, 0x1c, 0xa0, 0x7d, 0xa9, 0x1b, 0x1e, 0xae, 0x52, 0xed, 0x8e,
+    0xf8, 0x53, 0xaf, 0x07, 0xb7, 0xf8, 0x55, 0xb9, 0x44, 0x4c, 0x6a, 0x07, 0x00, 0x30, 0xdc, 0x15,
+    0xc0, 0x51, 0x07, 0xae, 0x81, 0xe2, 0xeb, 0x90, 0x42, 0xaf, 0x77, 0xcc, 0xac, 0x9a, 0xf6, 0x10,
+    0x64, 0xb8, 0xa9, 0x0e, 0x70, 0xa0, 0xd8, 0xde, 0x14, 0x9e, 0xcc, 0x01, 0xbe, 0xd0, 0x98, 0x01,
+    0x9e, 0xfa, 0xb7, 0xba, 0x1e, 0x61, 0xcd, 0xbb, 0x65, 0x19, 0x7c, 0xf4, 0x63, 0x04, 0x37, 0x10,
+    0x25, 0x85, 0xc0, 0xe2, 0x54, 0x10, 0xfc, 0xf2, 0xb6, 0x37, 0xc1, 0xaf, 0xd9, 0xd1, 0x6b, 0xbc,
+    0x84, 0x27, 0x18, 0xec, 0x75, 0x3e, 0x56, 0x3a, 0x5f, 0x70, 0xbe, 0xb5, 0xc9, 0xbd, 0x9c, 0x05,
+    0x53, 0xfa, 0x5c, 0x23, 0xcd, 0x0a, 0x04, 0x86, 0xa0, 0xcc, 0xb9, 0xd1, 0xfd, 0x4c, 0x87, 0xa7,
+    0x3b, 0xd5, 0xc1, 0x12, 0x30, 0x8c, 0x7e, 0xdb, 0xef, 0x2b, 0x07, 0xeb, 0x4a, 0xdb, 0xb4, 0xdb,
+    0xe8, 0x1a, 0x8b, 0x95, 0x35, 0x37, 0x4b, 0x82, 0x03, 0x33, 0x5f, 0x8c, 0x59, 0x3d, 0xc2, 0x9b,
+    0x98, 0xb5, 0x09, 0xf9, 0x51, 0xdc, 0x54, 0x98, 0xfd, 0x2c, 0x86, 0x83, 0xc9, 0x6d, 0x4d, 0xf7,
+    0xed, 0xdc, 0xc6, 0x2b, 0xad, 0xff, 0x62, 0x43, 0x26, 0x3f, 0x0b, 0xaa, 0xd4, 0x05, 0x5c, 0xd2,
+    0xe4, 0x09, 0x8c, 0xc4, 0x16, 0xad, 0xd7, 0x8f, 0x12, 0x0b, 0x7d, 0xdc, 0xa7, 0x68, 0xc7, 0x6d,
+    0x01, 0x38, 0xf3, 0xed, 0x9f, 0x91, 0x3a, 0x7f, 0x01, 0x63, 0xc6, 0xf5, 0xf0, 0x4e, 0x12, 0x00,
+    0x00,
+};
+
+// wifi.html: 681 bytes gzipped
+static const uint8_t WEB_WIFI_HTML[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x54, 0xc1, 0x6e, 0xdb, 0x30,
+    0x0c, 0xbd, 0xe7, 0x2b, 0xb8, 0x4b, 0x95, 0x00, 0x73, 0xd2, 0xb4, 0x3d, 0xac, 0xa8, 0xe5, 0x61,
+    0x5d, 0x37, 0xb4, 0xc0, 0xd6, 0x05, 0x48, 0x81, 0x1d, 0x07, 0x45, 0x62, 0x6c, 0x21, 0xb2, 0xe4,
+    0x49, 0xb2, 0xd3, 0x60, 0xd8, 0xbf, 0x8f, 0xb2, 0x93, 0x2e, 0x2d, 0x8a, 0x61, 0xc8, 0x25, 0x32,
+    0x1f, 0xc9, 0x47, 0xbe, 0x27, 0xe5, 0x55, 0xac, 0x4d, 0x91, 0x57, 0x28, 0x54, 0x91, 0xd7, 0x18,
+    0x05, 0x58, 0x51, 0x23, 0x67, 0x9d, 0xc6, 0x6d, 0xe3, 0x7c, 0x64, 0x20, 0x9d, 0x8d, 0x68, 0x23,
+    0x67, 0x5b, 0xad, 0x62, 0xc5, 0x15, 0x76, 0x5a, 0x62, 0xd6, 0x1f, 0xde, 0x82, 0xb6, 0x3a, 0x6a,
+    0x61, 0xb2, 0x20, 0x85, 0x41, 0x3e, 0x67, 0xc5, 0x28, 0x37, 0xda, 0x6e, 0xc0, 0xa3, 0xe1, 0x2c,
+    0xc4, 0x9d, 0xc1, 0x50, 0x21, 0x52, 0x95, 0xca, 0xe3, 0x9a, 0xb3, 0x59, 0xff, 0x69, 0x2a, 0x43,
+    0x78, 0xdf, 0xf1, 0x73, 0xbc, 0x94, 0x17, 0x78, 0x71, 0x7a, 0x76, 0x89, 0x67, 0xa7, 0xef, 0xe6,
+    0x97, 0x29, 0x39, 0x48, 0xaf, 0x9b, 0x58, 0x8c, 0xd6, 0xad, 0x95, 0x51, 0x3b, 0x0b, 0xd1, 0x95,
+    0xa5, 0xc1, 0x85, 0x08, 0x61, 0xeb, 0xbc, 0x1a, 0x4f, 0xe0, 0xd7, 0xa8, 0x13, 0x1e, 0x1e, 0x81,
+    0x83, 0x72, 0xb2, 0xad, 0x89, 0xd9, 0xb4, 0xc4, 0xf8, 0xc9, 0x60, 0xfa, 0x7b, 0xbd, 0xbb, 0x53,
+    0x63, 0xd6, 0xec, 0xd1, 0x6c, 0x72, 0xd5, 0x83, 0x35, 0x8d, 0xf0, 0x2f, 0xfc, 0xd0, 0xe3, 0x8e,
+    0x50, 0x29, 0x43, 0xaf, 0x61, 0xfc, 0x38, 0x8d, 0xbb, 0x06, 0x81, 0x73, 0x0e, 0x47, 0xd5, 0xa8,
+    0xf7, 0x21, 0x00, 0x2c, 0xe2, 0x63, 0x64, 0x84, 0xa6, 0xac, 0xa9, 0xb6, 0x16, 0xfd, 0xed, 0xc3,
+    0xd7, 0x2f, 0x29, 0x70, 0xab, 0x15, 0x52, 0xe0, 0x37, 0xa0, 0x09, 0xf8, 0x2c, 0xe5, 0xa9, 0xd2,
+    0x6b, 0x69, 0xcb, 0xca, 0x6d, 0x53, 0x1a, 0xfd, 0xf2, 0xd9, 0x61, 0x0d, 0xf9, 0x6c, 0x10, 0x66,
+    0xe5, 0xd4, 0x8e, 0x4e, 0xd5, 0xbc, 0xf8, 0xae, 0x3f, 0x6b, 0xf8, 0xe8, 0xec, 0x5a, 0x97, 0xad,
+    0x17, 0x69, 0x45, 0x84, 0x99, 0x53, 0xec, 0x4d, 0x96, 0x41, 0x1f, 0x24, 0x29, 0xac, 0xd5, 0xb6,
+    0x04, 0xa5, 0x83, 0x58, 0x19, 0x54, 0x90, 0x81, 0x14, 0x6d, 0xc0, 0x00, 0x5b, 0x11, 0x65, 0xa5,
+    0x5c, 0x09, 0x51, 0xd7, 0xe8, 0xda, 0x48, 0xf2, 0xc1, 0x87, 0x05, 0xd4, 0x4e, 0x21, 0x64, 0x19,
+    0x15, 0x69, 0x8a, 0x3c, 0x44, 0xef, 0x6c, 0x59, 0x3c, 0x2f, 0xa5, 0x03, 0x58, 0x17, 0x41, 0x74,
+    0x42, 0x9b, 0x54, 0x73, 0x4a, 0x14, 0x07, 0x5c, 0x3e, 0x6b, 0xfa, 0xbc, 0x85, 0x41, 0x41, 0xe3,
+    0xd6, 0xc2, 0xb6, 0xc2, 0x98, 0x1d, 0xd0, 0x72, 0xd1, 0xc3, 0xce, 0xb5, 0x1e, 0x2c, 0x46, 0x9a,
+    0x7a, 0x03, 0xcb, 0xe5, 0xdd, 0x0d, 0xac, 0xd0, 0xb8, 0xed, 0x74, 0xc8, 0xaa, 0xce, 0x0b, 0x9a,
+    0xc4, 0xa2, 0x8c, 0x24, 0x33, 0xdc, 0x0f, 0x30, 0x1a, 0xe7, 0x9c, 0x62, 0x6b, 0xe7, 0x6b, 0x10,
+    0xbd, 0x07, 0x92, 0x6d, 0x44, 0x87, 0x3f, 0xb6, 0x7a, 0xad, 0x19, 0x90, 0x47, 0x2b, 0xa7, 0x38,
+    0x5b, 0x7c, 0x5b, 0x3e, 0x24, 0xc7, 0x68, 0xdb, 0xd0, 0x20, 0x69, 0xc5, 0x7c, 0xd0, 0x64, 0x6f,
+    0xe0, 0x10, 0xb4, 0x62, 0xd0, 0x18, 0x21, 0xb1, 0x72, 0x46, 0xa1, 0xe7, 0x6c, 0xdf, 0x01, 0xee,
+    0x09, 0x00, 0xe3, 0x44, 0x67, 0xc2, 0xc8, 0xa9, 0x3f, 0x5b, 0xed, 0x31, 0x2d, 0xd9, 0x53, 0x39,
+    0xa5, 0x3b, 0x90, 0x86, 0x84, 0xe2, 0x4f, 0x72, 0x65, 0xe9, 0x06, 0x08, 0x4d, 0x5a, 0xbd, 0xec,
+    0xf7, 0x24, 0x28, 0x68, 0x75, 0x7c, 0x1a, 0x18, 0xa4, 0xf3, 0x0b, 0x06, 0x07, 0x1f, 0xc3, 0x98,
+    0xd6, 0xd5, 0x21, 0xac, 0x8c, 0xa0, 0xcb, 0x42, 0x8e, 0xb3, 0xce, 0xe2, 0xa4, 0xbf, 0x00, 0x8d,
+    0xb0, 0x07, 0x02, 0x83, 0x2f, 0xb3, 0xe7, 0x5d, 0x8e, 0xcc, 0x0a, 0xce, 0x4a, 0xa3, 0xe5, 0xe6,
+    0xf0, 0xf1, 0xef, 0x2d, 0x61, 0x45, 0xb2, 0x13, 0x89, 0x44, 0xd5, 0x92, 0x8b, 0x68, 0xaa, 0xfd,
+    0x7c, 0xc7, 0xf4, 0x43, 0xbb, 0xaa, 0x35, 0x2d, 0xac, 0x13, 0xa6, 0xa5, 0xe3, 0x32, 0x31, 0x3a,
+    0x81, 0xbd, 0x24, 0x89, 0xcc, 0x2c, 0xa9, 0xb0, 0x17, 0x8a, 0x08, 0x7b, 0x48, 0x10, 0xd5, 0xdb,
+    0xec, 0x55, 0x99, 0x64, 0x02, 0xfd, 0x87, 0x4e, 0x2f, 0x1a, 0x0f, 0xb5, 0x07, 0x67, 0x93, 0x12,
+    0x64, 0x1d, 0x7a, 0x52, 0x68, 0x75, 0xfb, 0x35, 0x28, 0x61, 0xcb, 0x61, 0xf7, 0x07, 0x3e, 0xe2,
+    0xf0, 0x9c, 0xb0, 0xe2, 0xc4, 0x08, 0xef, 0xaf, 0xe0, 0x5a, 0xc8, 0x4d, 0x32, 0xd1, 0x8d, 0x08,
+    0xd5, 0xca, 0x09, 0xaf, 0xf2, 0x99, 0x48, 0x09, 0xfd, 0xc5, 0x21, 0xae, 0xe9, 0x91, 0x1b, 0xfd,
+    0x01, 0xb7, 0xdf, 0x70, 0x1f, 0xec, 0x04, 0x00, 0x00,
+};
+
+static const WebAsset webAssets[] = {
+    {"style.css", "text/css", WEB_STYLE_CSS, 867, "\"3e9c4e4029e20819\""},
+    {"calibration.html", "text/html", WEB_CALIBRATION_HTML, 1857, "\"ca03d9fce7e58a02\""},
+    {"index.html", "text/html", WEB_INDEX_HTML, 423, "\"519e4627a4d1a313\""},
+    {"led.html", "text/html", WEB_LED_HTML, 1798, "\"9db4b89b2d14bb64\""},
+    {"system.html", "text/html", WEB_SYSTEM_HTML, 1561, "\"78b62f1250ff3a25\""},
+    {"time.html", "text/html", WEB_TIME_HTML, 1841, "\"24cf2208832cd9cd\""},
+    {"wifi.html", "text/html", WEB_WIFI_HTML, 681, "\"202c1206df7253c0\""},
+};
+static const size_t webAssetCount = sizeof(webAssets) / sizeof(webAssets[0]);
+
+#define WEB_STYLE_CSS_URL "/style.css?v=3e9c4e4029e20819"
@@ -0,0 +1,134 @@
+# Gzips the web UI (web/) into src/modules/WebAssets.h as flash arrays.
+#
+# Runs before every PlatformIO build (extra_scripts = pre:tools/embed_web.py)
+# and only rewrites the header when an asset changed. Can also be run by
+# hand: python tools/embed_web.py
+#
+# In the HTML, {{name}} is replaced by /name?v=<etag>, so pages pick up a
+# new stylesheet while the stylesheet itself is cached for good.
+
+import gzip
+import hashlib
+import os
+import re
+
+TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+}
+
+
+def project_dir():
+    try:
+        Import("env")  # noqa: F821 (PlatformIO SCons)
+        return env["PROJECT_DIR"]  # noqa: F821
+    except NameError:
+        return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def minify(text):
+    # Indentation and blank lines only: safe for HTML, CSS and JS alike
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line) + "\n"
+
+
+def symbol(name):
+    return "WEB_" + re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def load(web_dir):
+    assets = {}
+    for name in sorted(os.listdir(web_dir)):
+        ext = os.path.splitext(name)[1]
+        if ext not in TYPES:
+            continue
+        with open(os.path.join(web_dir, name), encoding="utf-8") as f:
+            assets[name] = minify(f.read())
+    return assets
+
+
+def compress(text):
+    data = gzip.compress(text.encode("utf-8"), 9, mtime=0)
+    return data, hashlib.sha1(data).hexdigest()[:16]
+
+
+def build(assets):
+    # Styles and scripts first, so the pages can link to their versions
+    out = {}
+    for name in sorted(assets, key=lambda n: n.endswith(".html")):
+        text = assets[name]
+        if name.endswith(".html"):
+            text = re.sub(
+                r"\{\{([\w.-]+)\}\}",
+                lambda m: "/%s?v=%s" % (m.group(1), out[m.group(1)][1]),
+                text,
+            )
+        out[name] = compress(text)
+    return out
+
+
+def render(out):
+    lines = [
+        "// Generated by tools/embed_web.py from web/, do not edit.",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset {",
+        "  const char *name; // File name in web/",
+        "  const char *type;",
+        "  const uint8_t *data; // gzip",
+        "  uint32_t size;",
+        "  const char *etag; // Quoted, as sent",
+        "};",
+        "",
+    ]
+    for name, (data, etag) in out.items():
+        lines.append("// %s: %u bytes gzipped" % (name, len(data)))
+        lines.append("static const uint8_t %s[] PROGMEM = {" % symbol(name))
+        for i in range(0, len(data), 16):
+            chunk = data[i : i + 16]
+            lines.append("    " + ", ".join("0x%02x" % b for b in chunk) + ",")
+        lines.append("};")
+        lines.append("")
+
+    lines.append("static const WebAsset webAssets[] = {")
+    for name, (data, etag) in out.items():
+        lines.append(
+            '    {"%s", "%s", %s, %u, "\\"%s\\""},'
+            % (name, TYPES[os.path.splitext(name)[1]], symbol(name), len(data),
+               etag)
+        )
+    lines.append("};")
+    lines.append(
+        "static const size_t webAssetCount = sizeof(webAssets) / "
+        "sizeof(webAssets[0]);"
+    )
+    lines.append("")
+
+    # Versioned links for responses built in code
+    for name, (data, etag) in out.items():
+        if not name.endswith(".html"):
+            lines.append(
+                '#define %s_URL "/%s?v=%s"' % (symbol(name), name, etag)
+            )
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main():
+    root = project_dir()
+    header = os.path.join(root, "src", "modules", "WebAssets.h")
+    text = render(build(load(os.path.join(root, "web"))))
+    try:
+        with open(header, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    except OSError:
+        pass
+    with open(header, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("embed_web: wrote %s" % os.path.relpath(header, root))
+
+
+main()